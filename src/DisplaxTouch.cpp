@@ -7,8 +7,52 @@
 const uint32_t DisplaxTouch::CRC32_TABLE[16] = {
     0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005, 0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD};
 
+const uint32_t DisplaxTouch::CRC32_SYNDROMES[TOUCH_PAYLOAD_SIZE * 8] = {
+    0xE6228B11, 0xC8840B95, 0x95C90A9D, 0x2F53088D, 0x5EA6111A, 0xBD4C2234, 0x7E5959DF, 0xFCB2B3BE, 0xFDA47ACB, 0xFF89E821, 0xFBD2CDF5, 0xF364865D, 0xE208110D, 0xC0D13FAD, 0x856362ED, 0x0E07D86D,
+    0x1C0FB0DA, 0x381F61B4, 0x703EC368, 0xE07D86D0, 0xC43A1017, 0x8CB53D99, 0x1DAB6685, 0x3B56CD0A, 0x76AD9A14, 0xED5B3428, 0xDE7775E7, 0xB82FF679, 0x749EF145, 0xE93DE28A, 0xD6BAD8A3, 0xA9B4ACF1,
+    0xD3504EC7, 0xA2618039, 0x40021DC5, 0x80043B8A, 0x04C96AA3, 0x0992D546, 0x1325AA8C, 0x264B5518, 0x4C96AA30, 0x992D5460, 0x369BB577, 0x6D376AEE, 0xDA6ED5DC, 0xB01CB60F, 0x64F871A9, 0xC9F0E352,
+    0x9720DB13, 0x2A80AB91, 0x55015722, 0xAA02AE44, 0x50C4413F, 0xA188827E, 0x47D0194B, 0x8FA03296, 0x1B81789B, 0x3702F136, 0x6E05E26C, 0xDC0BC4D8, 0xBCD69407, 0x7D6C35B9, 0xFAD86B72, 0xF171CB53,
+    0x64BF7A9B, 0xC97EF536, 0x963CF7DB, 0x28B8F201, 0x5171E402, 0xA2E3C804, 0x41068DBF, 0x820D1B7E, 0x00DB2B4B, 0x01B65696, 0x036CAD2C, 0x06D95A58, 0x0DB2B4B0, 0x1B656960, 0x36CAD2C0, 0x6D95A580,
+    0xDB2B4B00, 0xB2978BB7, 0x61EE0AD9, 0xC3DC15B2, 0x837936D3, 0x02337011, 0x0466E022, 0x08CDC044, 0x119B8088, 0x23370110, 0x466E0220, 0x8CDC0440, 0x1D791537, 0x3AF22A6E, 0x75E454DC, 0xEBC8A9B8,
+    0x766F1B78, 0xECDE36F0, 0xDD7D7057, 0xBE3BFD19, 0x78B6E785, 0xF16DCF0A, 0xE61A83A3, 0xC8F41AF1, 0x95292855, 0x2E934D1D, 0x5D269A3A, 0xBA4D3474, 0x705B755F, 0xE0B6EABE, 0xC5ACC8CB, 0x8F988C21,
+    0x1BF005F5, 0x37E00BEA, 0x6FC017D4, 0xDF802FA8, 0xBBC142E7, 0x73439879, 0xE68730F2, 0xC9CF7C53, 0x975FE511, 0x2A7ED795, 0x54FDAF2A, 0xA9FB5E54, 0x5737A11F, 0xAE6F423E, 0x581F99CB, 0xB03F3396,
+    0x8C3828A8, 0x1CB14CE7, 0x396299CE, 0x72C5339C, 0xE58A6738, 0xCFD5D3C7, 0x9B6ABA39, 0x321469C5, 0x6428D38A, 0xC851A714, 0x9462539F, 0x2C05BA89, 0x580B7512, 0xB016EA24, 0x64ECC9FF, 0xC9D993FE,
+    0x97723A4B, 0x2A256921, 0x544AD242, 0xA895A484, 0x55EA54BF, 0xABD4A97E, 0x53684F4B, 0xA6D09E96, 0x4960209B, 0x92C04136, 0x21419FDB, 0x42833FB6, 0x85067F6C, 0x0ECDE36F, 0x1D9BC6DE, 0x3B378DBC,
+    0xC053585D, 0x8467AD0D, 0x0C0E47AD, 0x181C8F5A, 0x30391EB4, 0x60723D68, 0xC0E47AD0, 0x8509E817, 0x0ED2CD99, 0x1DA59B32, 0x3B4B3664, 0x76966CC8, 0xED2CD990, 0xDE98AE97, 0xB9F04099, 0x77219C85,
+    0xEE43390A, 0xD8476FA3, 0xB44FC2F1, 0x6C5E9855, 0xD8BD30AA, 0xB5BB7CE3, 0x6FB7E471, 0xDF6FC8E2, 0xBA1E8C73, 0x70FC0551, 0xE1F80AA2, 0xC73108F3, 0x8AA30C51, 0x11870515, 0x230E0A2A, 0x461C1454,
+    0x569700E5, 0xAD2E01CA, 0x5E9D1E23, 0xBD3A3C46, 0x7EB5653B, 0xFD6ACA76, 0xFE14895B, 0xF8E80F01, 0xF51103B5, 0xEEE31ADD, 0xD907280D, 0xB6CF4DAD, 0x695F86ED, 0xD2BF0DDA, 0xA1BF0603, 0x47BF11B1,
+    0x8F7E2362, 0x1A3D5B73, 0x347AB6E6, 0x68F56DCC, 0xD1EADB98, 0xA714AA87, 0x4AE848B9, 0x95D09172, 0x2F603F53, 0x5EC07EA6, 0xBD80FD4C, 0x7FC0E72F, 0xFF81CE5E, 0xFBC2810B, 0xF3441FA1, 0xE24922F5,
+    0xAB40B71E, 0x5240738B, 0xA480E716, 0x4DC0D39B, 0x9B81A736, 0x33C253DB, 0x6784A7B6, 0xCF094F6C, 0x9AD3836F, 0x31661B69, 0x62CC36D2, 0xC5986DA4, 0x8FF1C6FF, 0x1B229049, 0x36452092, 0x6C8A4124,
+    0xD9148248, 0xB6E81927, 0x69112FF9, 0xD2225FF2, 0xA085A253, 0x45CA5911, 0x8B94B222, 0x13E879F3, 0x27D0F3E6, 0x4FA1E7CC, 0x9F43CF98, 0x3A468287, 0x748D050E, 0xE91A0A1C, 0xD6F5098F, 0xA92B0EA9,
+    0x75BE46B7, 0xEB7C8D6E, 0xD238076B, 0xA0B11361, 0x45A33B75, 0x8B4676EA, 0x124DF063, 0x249BE0C6, 0x4937C18C, 0x926F8318, 0x201E1B87, 0x403C370E, 0x80786E1C, 0x0431C18F, 0x0863831E, 0x10C7063C,
+    0x218E0C78, 0x431C18F0, 0x863831E0, 0x08B17E77, 0x1162FCEE, 0x22C5F9DC, 0x458BF3B8, 0x8B17E770, 0x12EED357, 0x25DDA6AE, 0x4BBB4D5C, 0x97769AB8, 0x2A2C28C7, 0x5458518E, 0xA8B0A31C, 0x55A05B8F,
+    0xCD8C54B5, 0x9FD9B4DD, 0x3B72740D, 0x76E4E81A, 0xEDC9D034, 0xDF52BDDF, 0xBA646609, 0x7009D1A5, 0xE013A34A, 0xC4E65B23, 0x8D0DABF1, 0x1EDA4A55, 0x3DB494AA, 0x7B692954, 0xF6D252A8, 0xE965B8E7,
+    0xD60A6C79, 0xA8D5C545, 0x556A973D, 0xAAD52E7A, 0x516B4143, 0xA2D68286, 0x416C18BB, 0x82D83176, 0x01717F5B, 0x02E2FEB6, 0x05C5FD6C, 0x0B8BFAD8, 0x1717F5B0, 0x2E2FEB60, 0x5C5FD6C0, 0xB8BFAD80,
+    0xC5B9CD4C, 0x8FB2872F, 0x1BA413E9, 0x374827D2, 0x6E904FA4, 0xDD209F48, 0xBE802327, 0x79C15BF9, 0xF382B7F2, 0xE3C47253, 0xC349F911, 0x8252EF95, 0x0064C29D, 0x00C9853A, 0x01930A74, 0x032614E8,
+    0x064C29D0, 0x0C9853A0, 0x1930A740, 0x32614E80, 0x64C29D00, 0xC9853A00, 0x97CB69B7, 0x2B57CED9, 0x56AF9DB2, 0xAD5F3B64, 0x5E7F6B7F, 0xBCFED6FE, 0x7D3CB04B, 0xFA796096, 0xF033DC9B, 0xE4A6A481,
+    0x17D3315D, 0x2FA662BA, 0x5F4CC574, 0xBE998AE8, 0x79F20867, 0xF3E410CE, 0xE3093C2B, 0xC2D365E1, 0x8167D675, 0x060EB15D, 0x0C1D62BA, 0x183AC574, 0x30758AE8, 0x60EB15D0, 0xC1D62BA0, 0x876D4AF7,
+    0x0A1B8859, 0x143710B2, 0x286E2164, 0x50DC42C8, 0xA1B88590, 0x47B01697, 0x8F602D2E, 0x1A0147EB, 0x34028FD6, 0x68051FAC, 0xD00A3F58, 0xA4D56307, 0x4D6BDBB9, 0x9AD7B772, 0x316E7353, 0x62DCE6A6,
+    0xE8A45605, 0xD589B1BD, 0xAFD27ECD, 0x5B65E02D, 0xB6CBC05A, 0x69569D03, 0xD2AD3A06, 0xA19B69BB, 0x47F7CEC1, 0x8FEF9D82, 0x1B1E26B3, 0x363C4D66, 0x6C789ACC, 0xD8F13598, 0xB5237687, 0x6E87F0B9,
+    0xDD0FE172, 0xBEDEDF53, 0x797CA311, 0xF2F94622, 0xE13391F3, 0xC6A63E51, 0x898D6115, 0x17DBDF9D, 0x2FB7BF3A, 0x5F6F7E74, 0xBEDEFCE8, 0x797CE467, 0xF2F9C8CE, 0xE1328C2B, 0xC6A405E1, 0x89891675,
+    0xF200AA66, 0xE0C0497B, 0xC5418F41, 0x8E420335, 0x18451BDD, 0x308A37BA, 0x61146F74, 0xC228DEE8, 0x8090A067, 0x05E05D79, 0x0BC0BAF2, 0x178175E4, 0x2F02EBC8, 0x5E05D790, 0xBC0BAF20, 0x7CD643F7,
+    0xF9AC87EE, 0xF798126B, 0xEBF13961, 0xD3236F75, 0xA287C35D, 0x41CE9B0D, 0x839D361A, 0x03FB7183, 0x07F6E306, 0x0FEDC60C, 0x1FDB8C18, 0x3FB71830, 0x7F6E3060, 0xFEDC60C0, 0xF979DC37, 0xF632A5D9,
+    0x490D678D, 0x921ACF1A, 0x20F48383, 0x41E90706, 0x83D20E0C, 0x036501AF, 0x06CA035E, 0x0D9406BC, 0x1B280D78, 0x36501AF0, 0x6CA035E0, 0xD9406BC0, 0xB641CA37, 0x684289D9, 0xD08513B2, 0xA5CB3AD3,
+    0x4F576811, 0x9EAED022, 0x399CBDF3, 0x73397BE6, 0xE672F7CC, 0xC824F22F, 0x9488F9E9, 0x2DD0EE65, 0x5BA1DCCA, 0xB743B994, 0x6A466E9F, 0xD48CDD3E, 0xADD8A7CB, 0x5F705221, 0xBEE0A442, 0x79005533,
+    0x04C11DB7, 0x09823B6E, 0x130476DC, 0x2608EDB8, 0x4C11DB70, 0x9823B6E0, 0x34867077, 0x690CE0EE, 0xD219C1DC, 0xA0F29E0F, 0x452421A9, 0x8A484352, 0x10519B13, 0x20A33626, 0x41466C4C, 0x828CD898,
+    0x01D8AC87, 0x03B1590E, 0x0762B21C, 0x0EC56438, 0x1D8AC870, 0x3B1590E0, 0x762B21C0, 0xEC564380, 0xDC6D9AB7, 0xBC1A28D9, 0x7CF54C05, 0xF9EA980A, 0xF7142DA3, 0xEAE946F1, 0xD1139055, 0xA6E63D1D,
+};
+
 DisplaxTouch::DisplaxTouch(Stream& stream, TouchOrientation orientation)
     : stream(stream)
+    , clock(arduinoClock)
+    , orientation(orientation) {
+    // Initialize RX buffer
+    memset(rxBuffer, 0, sizeof(rxBuffer));
+}
+
+DisplaxTouch::DisplaxTouch(Stream& stream, TouchClock& clock, TouchOrientation orientation)
+    : stream(stream)
+    , clock(clock)
     , orientation(orientation) {
     // Initialize RX buffer
     memset(rxBuffer, 0, sizeof(rxBuffer));
@@ -18,7 +62,7 @@ void DisplaxTouch::begin() {
     log("Initializing");
 
     // Track initialization start time for timeout detection
-    initializingStartTimeMs = millis();
+    initializingStartTimeMs = clock.millis();
 
     // Flush any possibly queued stream data
     while (stream.available()) {
@@ -30,30 +74,53 @@ void DisplaxTouch::begin() {
 }
 
 void DisplaxTouch::loop() {
-    unsigned long currentTimeMs = millis();
+    checkTimeouts();
+
+    // Read and process stream data
+    readStreamData();
+}
+
+void DisplaxTouch::loop(unsigned long budgetUs, uint8_t maxReports) {
+    unsigned long startTimeUs = clock.micros();
+
+    checkTimeouts();
+
+    // Read at most one touch report worth of bytes per step so both reading and processing stay bounded. The latest-wins
+    // policy needs the whole backlog buffered to find the newest report, which is still bounded by the buffer size.
+    size_t maxBytesPerStep = backlogPolicy == TouchBacklogPolicy::LatestWins ? RX_BUFFER_SIZE : TOUCH_REPORT_SIZE;
+
+    for (uint8_t reportCount = 0; maxReports == 0 || reportCount < maxReports; reportCount++) {
+        bool isProgressing = readStreamData(maxBytesPerStep);
+
+        if (!isProgressing || clock.micros() - startTimeUs >= budgetUs) {
+            break;
+        }
+    }
+}
+
+size_t DisplaxTouch::getBacklog() {
+    return rxBufferSize + static_cast<size_t>(stream.available());
+}
+
+void DisplaxTouch::checkTimeouts() {
+    unsigned long currentTimeMs = clock.millis();
 
     // Check for initialization timeout
-    if (state == TouchState::INITIALIZING && initializingStartTimeMs > 0) {
+    if (state == TouchState::INITIALIZING) {
         if (currentTimeMs - initializingStartTimeMs >= INITIALIZATION_TIMEOUT_MS) {
             warn("Initialization timeout - no response from sensor in %lu ms", INITIALIZATION_TIMEOUT_MS);
             setState(TouchState::INITIALIZATION_FAILED);
-
-            // Reset to prevent repeated failures
-            initializingStartTimeMs = 0;
         }
     }
 
     // Clear touches on timeout (sensor only sends touch events when touched)
-    if (touchCount > 0 && !isTouchTimeoutFired && lastTouchTimeMs > 0) {
-        if (currentTimeMs - lastTouchTimeMs >= touchTimeoutMs) {
+    if (touchCount > 0 && !isTouchTimeoutFired) {
+        if (currentTimeMs - lastTouchTimeMs >= getEffectiveTouchTimeout()) {
             clearTouches();
 
             isTouchTimeoutFired = true;
         }
     }
-
-    // Read and process stream data
-    readStreamData();
 }
 
 void DisplaxTouch::sendCommand(Command command) {
@@ -70,6 +137,10 @@ void DisplaxTouch::sendCommand(Command command) {
 }
 
 void DisplaxTouch::consumeBuffer(size_t bytesToConsume) {
+    // A different frame will be at the buffer start, restart the running CRC
+    headFrameCrc = CRC32_INITIAL;
+    headFrameCrcLength = 0;
+
     // Clear entire buffer if consuming all or more bytes than available
     if (bytesToConsume >= rxBufferSize) {
         rxBufferSize = 0;
@@ -112,6 +183,92 @@ bool DisplaxTouch::isValidTouchFrame(uint8_t* data, size_t length) {
     return validHeader;
 }
 
+bool DisplaxTouch::isIntactTouchFrame(const uint8_t* data, size_t length) const {
+    if (length < TOUCH_REPORT_SIZE || data[0] != 0x04 || data[1] != 0x00 || data[2] != 0x40 || data[3] != 0x00) {
+        return false;
+    }
+
+    // The frame at the buffer start is covered by the running CRC once it has been fully received
+    if (data == rxBuffer && headFrameCrcLength == TOUCH_REPORT_SIZE - TOUCH_CRC_SIZE) {
+        return headFrameCrc == readStoredCRC(data);
+    }
+
+    return calculateCRC32(data, TOUCH_REPORT_SIZE - TOUCH_CRC_SIZE) == readStoredCRC(data);
+}
+
+int DisplaxTouch::findLatestTouchFrame(const uint8_t* data, size_t length) const {
+    if (length < TOUCH_REPORT_SIZE) {
+        return -1;
+    }
+
+    // Search from the newest complete frame position backwards, CRC is only calculated where a header matches
+    for (size_t position = length - TOUCH_REPORT_SIZE + 1; position-- > 0;) {
+        if (isIntactTouchFrame(data + position, length - position)) {
+            return static_cast<int>(position);
+        }
+    }
+
+    return -1;
+}
+
+void DisplaxTouch::skipStaleTouchReports() {
+    size_t offset = 0;
+
+    // A report is stale when another intact report immediately follows it. Each CRC is checked once: the following
+    // report is checked first (usually there is none), the head report uses the running CRC and every later report
+    // was already checked as the following report of the previous iteration.
+    while (rxBufferSize - offset >= 2 * TOUCH_REPORT_SIZE && isIntactTouchFrame(rxBuffer + offset + TOUCH_REPORT_SIZE, rxBufferSize - offset - TOUCH_REPORT_SIZE)) {
+        if (offset == 0 && !isIntactTouchFrame(rxBuffer, rxBufferSize)) {
+            break;
+        }
+
+        processStaleTouchReport(rxBuffer + offset);
+
+        offset += TOUCH_REPORT_SIZE;
+    }
+
+    if (offset > 0) {
+        log("Skipped %zu stale touch reports", offset / TOUCH_REPORT_SIZE);
+
+        consumeBuffer(offset);
+
+        // The newest report is now at the head and known to be intact, so its running CRC equals the stored one
+        headFrameCrc = readStoredCRC(rxBuffer);
+        headFrameCrcLength = TOUCH_REPORT_SIZE - TOUCH_CRC_SIZE;
+    }
+}
+
+void DisplaxTouch::processStaleTouchReport(const uint8_t* data) {
+    parseTouchPayload(data + 4);
+    filterTouches();
+    updateFrameInterval(scanTime);
+
+    // Skipped reports all arrived together, map their scan time instead of feeding the arrival time to the fit
+    frameTimestampUs = clockSync.toHostTime(scanTime);
+    resampler.addFrame(touches, touchCount, frameTimestampUs);
+    updateContactHistory();
+
+    dispatchTouchEvents(false);
+}
+
+size_t DisplaxTouch::replayStaleTouchReports(size_t length) {
+    size_t staleReportCount = 0;
+    size_t position = 0;
+
+    // Intact reports are contiguous, anything else in between is skipped byte by byte until the next header
+    while (position + TOUCH_REPORT_SIZE <= length) {
+        if (isIntactTouchFrame(rxBuffer + position, length - position)) {
+            processStaleTouchReport(rxBuffer + position);
+            staleReportCount++;
+            position += TOUCH_REPORT_SIZE;
+        } else {
+            position++;
+        }
+    }
+
+    return staleReportCount;
+}
+
 void DisplaxTouch::synchronize() {
     // Need at least 4 bytes to find header
     if (rxBufferSize < 4) {
@@ -142,7 +299,10 @@ void DisplaxTouch::synchronize() {
 }
 
 uint32_t DisplaxTouch::calculateCRC32(const uint8_t* data, size_t length) {
-    uint32_t crc = 0xFFFFFFFF;
+    return updateCRC32(CRC32_INITIAL, data, length);
+}
+
+uint32_t DisplaxTouch::updateCRC32(uint32_t crc, const uint8_t* data, size_t length) {
     size_t wordCount = length / 4;
 
     // Process data in 32-bit words (length must be multiple of 4)
@@ -168,21 +328,92 @@ uint32_t DisplaxTouch::calculateCRC32(const uint8_t* data, size_t length) {
     return crc;
 }
 
-bool DisplaxTouch::verifyTouchCRC(const uint8_t* frame) {
-    // Calculate CRC over header + payload (68 bytes)
-    uint32_t calculatedCrc = calculateCRC32(frame, TOUCH_REPORT_SIZE - TOUCH_CRC_SIZE);
+uint32_t DisplaxTouch::readStoredCRC(const uint8_t* frame) {
+    return static_cast<uint32_t>(frame[68]) | (static_cast<uint32_t>(frame[69]) << 8) | (static_cast<uint32_t>(frame[70]) << 16) | (static_cast<uint32_t>(frame[71]) << 24);
+}
+
+void DisplaxTouch::updateHeadFrameCRC() {
+    bool isTouchFrameAtHead = rxBufferSize >= 4 && rxBuffer[0] == 0x04 && rxBuffer[1] == 0x00 && rxBuffer[2] == 0x40 && rxBuffer[3] == 0x00;
+
+    if (!isTouchFrameAtHead) {
+        return;
+    }
+
+    // Fold in the complete words received so far, limited to the header + payload region covered by the CRC
+    size_t crcRegionSize = TOUCH_REPORT_SIZE - TOUCH_CRC_SIZE;
+    size_t availableLength = (rxBufferSize < crcRegionSize ? rxBufferSize : crcRegionSize) & ~static_cast<size_t>(3);
+
+    if (availableLength > headFrameCrcLength) {
+        headFrameCrc = updateCRC32(headFrameCrc, rxBuffer + headFrameCrcLength, availableLength - headFrameCrcLength);
+        headFrameCrcLength = availableLength;
+    }
+}
+
+bool DisplaxTouch::verifyTouchCRC(uint8_t* frame) {
+    size_t crcRegionSize = TOUCH_REPORT_SIZE - TOUCH_CRC_SIZE;
+    uint32_t calculatedCrc;
+
+    // Calculate CRC over header + payload (68 bytes), reusing the running CRC for the frame at the buffer start
+    if (frame == rxBuffer) {
+        updateHeadFrameCRC();
+    }
+
+    if (frame == rxBuffer && headFrameCrcLength == crcRegionSize) {
+        calculatedCrc = headFrameCrc;
+    } else {
+        calculatedCrc = calculateCRC32(frame, crcRegionSize);
+    }
 
     // Extract stored CRC from frame (little-endian, bytes 68-71)
-    uint32_t storedCrc = static_cast<uint32_t>(frame[68]) | (static_cast<uint32_t>(frame[69]) << 8) | (static_cast<uint32_t>(frame[70]) << 16) | (static_cast<uint32_t>(frame[71]) << 24);
+    uint32_t storedCrc = readStoredCRC(frame);
+
+    if (calculatedCrc == storedCrc) {
+        return true;
+    }
 
-    bool isCrcValid = (calculatedCrc == storedCrc);
+    if (isErrorCorrectionEnabled && repairSingleBitError(frame, calculatedCrc ^ storedCrc)) {
+        correctedFrameCount++;
 
-    if (!isCrcValid) {
-        warn("CRC mismatch: calculated %s, stored %s", idToHex(calculatedCrc, 8).c_str(), idToHex(storedCrc, 8).c_str());
+        log("Corrected single-bit error in touch frame (syndrome: %s)", idToHex(calculatedCrc ^ storedCrc, 8).c_str());
+
+        return true;
+    }
+
+    warn("CRC mismatch: calculated %s, stored %s", idToHex(calculatedCrc, 8).c_str(), idToHex(storedCrc, 8).c_str());
+
+    // Only build the hex dump when someone is listening, it allocates a String for the whole frame
+    if (logCallback) {
         log("%s", bufferToHex(frame, TOUCH_REPORT_SIZE, "Touch frame").c_str());
     }
 
-    return isCrcValid;
+    return false;
+}
+
+bool DisplaxTouch::repairSingleBitError(uint8_t* frame, uint32_t syndrome) {
+    // A single set bit means the stored CRC field itself took the hit, the data is intact
+    if ((syndrome & (syndrome - 1)) == 0) {
+        uint8_t crcBit = 0;
+
+        while ((syndrome >> crcBit) != 1) {
+            crcBit++;
+        }
+
+        frame[TOUCH_REPORT_SIZE - TOUCH_CRC_SIZE + crcBit / 8] ^= static_cast<uint8_t>(1 << (crcBit % 8));
+
+        return true;
+    }
+
+    // Payload bit syndromes are all distinct and have more than one bit set, so a match pinpoints the flipped bit. The
+    // header needs no entries: a frame with a corrupted header is never recognized as a touch report to begin with.
+    for (size_t bitIndex = 0; bitIndex < TOUCH_PAYLOAD_SIZE * 8; bitIndex++) {
+        if (CRC32_SYNDROMES[bitIndex] == syndrome) {
+            frame[4 + bitIndex / 8] ^= static_cast<uint8_t>(1 << (bitIndex % 8));
+
+            return true;
+        }
+    }
+
+    return false;
 }
 
 void DisplaxTouch::sendReset() {
@@ -237,28 +468,55 @@ void DisplaxTouch::setState(TouchState newState) {
     }
 }
 
-void DisplaxTouch::readStreamData() {
-    // Drain everything currently waiting on the UART into the RX buffer in one batch. Reading a byte at a time across
-    // multiple loop() iterations would race the sensor's frame cadence and risk losing bytes to UART overrun.
-    while (stream.available() && rxBufferSize < RX_BUFFER_SIZE) {
+bool DisplaxTouch::readStreamData(size_t maxBytes) {
+    // Drain what is currently waiting on the UART into the RX buffer in one batch (unless limited by a loop() budget).
+    // Reading a byte at a time across multiple loop() iterations would race the sensor's frame cadence and risk losing
+    // bytes to UART overrun.
+    size_t bytesRead = 0;
+
+    while (stream.available() && rxBufferSize < RX_BUFFER_SIZE && bytesRead < maxBytes) {
         rxBuffer[rxBufferSize++] = stream.read();
+        bytesRead++;
+    }
+
+    // Keep the running CRC of the frame being received up to date
+    updateHeadFrameCRC();
+
+    // Jump straight to the newest report when several are queued
+    if (backlogPolicy == TouchBacklogPolicy::LatestWins && state == TouchState::SYNCHRONIZED) {
+        skipStaleTouchReports();
     }
 
-    // Buffer overflow protection
+    // Buffer overflow protection, the latest-wins policy keeps the newest intact report if there is one
     if (rxBufferSize >= RX_BUFFER_SIZE) {
-        warn("RX buffer overflow, resetting and searching for frame header");
-        rxBufferSize = 0;
+        int latestFramePosition = backlogPolicy == TouchBacklogPolicy::LatestWins ? findLatestTouchFrame(rxBuffer, rxBufferSize) : -1;
 
-        setState(TouchState::SYNCHRONIZING);
+        if (latestFramePosition < 0) {
+            warn("RX buffer overflow, resetting and searching for frame header");
+            consumeBuffer(rxBufferSize);
 
-        return;
+            setState(TouchState::SYNCHRONIZING);
+
+            return true;
+        }
+
+        // Discarded reports still contribute their Down/Up transitions, like reports skipped by skipStaleTouchReports()
+        size_t staleReportCount = replayStaleTouchReports(latestFramePosition);
+
+        warn("RX buffer overflow, skipping %d bytes (%zu intact reports) to the latest touch report", latestFramePosition, staleReportCount);
+        consumeBuffer(latestFramePosition);
+
+        setState(TouchState::SYNCHRONIZED);
     }
 
     // Need at least 2 bytes to determine report ID
     if (rxBufferSize < 2) {
-        return;
+        return bytesRead > 0;
     }
 
+    size_t bufferedSize = rxBufferSize;
+    TouchState previousState = state;
+
     // State machine for processing
     switch (state) {
         case TouchState::DISCONNECTED:
@@ -275,6 +533,8 @@ void DisplaxTouch::readStreamData() {
 
             break;
     }
+
+    return bytesRead > 0 || rxBufferSize != bufferedSize || state != previousState;
 }
 
 void DisplaxTouch::processStreamData(uint8_t* data, size_t length) {
@@ -367,9 +627,31 @@ void DisplaxTouch::processTouchReport(uint8_t* data, size_t length) {
         return;
     }
 
-    // Get pointer to payload (skip 4-byte header)
-    uint8_t* payload = data + 4;
+    // Parse touch points from payload (skip 4-byte header)
+    parseTouchPayload(data + 4);
+    filterTouches();
+    updateFrameInterval(scanTime);
+    frameTimestampUs = clockSync.update(scanTime, clock.micros());
+    resampler.addFrame(touches, touchCount, frameTimestampUs);
+    updateContactHistory();
 
+    // Track touch timing for timeout detection, releases reported by the sensor make the fallback timeout unnecessary
+    if (touchCount > 0) {
+        lastTouchTimeMs = clock.millis();
+        isTouchTimeoutFired = false;
+    } else {
+        isTouchTimeoutFired = true;
+    }
+
+    // Emit per-contact events and notify all registered listeners
+    dispatchTouchEvents();
+    notifyTouchListeners();
+
+    // Consume processed touch report
+    consumeBuffer(TOUCH_REPORT_SIZE);
+}
+
+void DisplaxTouch::parseTouchPayload(const uint8_t* payload) {
     // Extract touch count and scan time from payload
     // Payload structure (64 bytes):
     // - reportId: 1 byte at offset 0
@@ -385,13 +667,17 @@ void DisplaxTouch::processTouchReport(uint8_t* data, size_t length) {
 
     // Parse and store active touches
     touchCount = 0;
+    liftedCount = 0;
 
     for (size_t touchIndex = 0; touchIndex < reportedTouchCount && touchIndex < MAX_TOUCHES; touchIndex++) {
         const uint8_t* touchData = &payload[1 + touchIndex * 10];
         uint8_t touchStatus = touchData[0];
 
-        // Skip inactive touch slots
-        if (touchStatus == 0) {
+        // Skip inactive and lifted touch slots, a lifting contact is still reported with the tip switch bit cleared.
+        // Lifted ids are remembered so hysteresis can tell a real release from a dropout.
+        if ((touchStatus & TOUCH_STATUS_TIP_SWITCH) == 0) {
+            liftedIds[liftedCount++] = touchData[1];
+
             continue;
         }
 
@@ -401,11 +687,16 @@ void DisplaxTouch::processTouchReport(uint8_t* data, size_t length) {
         uint8_t rawWidth = touchData[6];
         uint8_t rawHeight = touchData[7];
 
+        if (isCalibrationEnabled) {
+            correctDistortion(rawX, rawY);
+        }
+
         // Store active touch point with orientation transformation applied
         TouchPoint& point = touches[touchCount++];
         point.id = touchData[1];
         point.pressure = static_cast<uint16_t>(touchData[8]) | (static_cast<uint16_t>(touchData[9]) << 8);
         point.active = true;
+        point.moved = true;
 
         // Apply coordinate transformation based on orientation
         switch (orientation) {
@@ -446,20 +737,480 @@ void DisplaxTouch::processTouchReport(uint8_t* data, size_t length) {
                 break;
         }
     }
+}
 
-    // Track touch timing for timeout detection
-    if (touchCount > 0) {
-        lastTouchTimeMs = millis();
-        isTouchTimeoutFired = false;
+void DisplaxTouch::correctDistortion(uint16_t& x, uint16_t& y) const {
+    if (frameWidth == 0 || frameHeight == 0) {
+        return;
+    }
+
+    // Grid position in 8.8 fixed point
+    uint32_t gridX = (static_cast<uint32_t>(x) * (CALIBRATION_COLUMNS - 1) << 8) / frameWidth;
+    uint32_t gridY = (static_cast<uint32_t>(y) * (CALIBRATION_ROWS - 1) << 8) / frameHeight;
+
+    // Positions on or beyond the last node use the last cell at full weight, clamped before narrowing to a cell index
+    uint32_t gridColumn = gridX >> 8;
+    uint32_t gridRow = gridY >> 8;
+    int32_t weightX = gridX & 0xFF;
+    int32_t weightY = gridY & 0xFF;
+
+    if (gridColumn >= CALIBRATION_COLUMNS - 1) {
+        gridColumn = CALIBRATION_COLUMNS - 2;
+        weightX = 256;
+    }
+
+    if (gridRow >= CALIBRATION_ROWS - 1) {
+        gridRow = CALIBRATION_ROWS - 2;
+        weightY = 256;
+    }
+
+    uint8_t column = static_cast<uint8_t>(gridColumn);
+    uint8_t row = static_cast<uint8_t>(gridRow);
+
+    // Bilinear interpolation of the four surrounding nodes, weights sum to 65536
+    size_t topLeft = row * CALIBRATION_COLUMNS + column;
+    size_t bottomLeft = topLeft + CALIBRATION_COLUMNS;
+    int32_t weightTopLeft = (256 - weightX) * (256 - weightY);
+    int32_t weightTopRight = weightX * (256 - weightY);
+    int32_t weightBottomLeft = (256 - weightX) * weightY;
+    int32_t weightBottomRight = weightX * weightY;
+
+    int32_t offsetX = calibrationOffsetsX[topLeft] * weightTopLeft + calibrationOffsetsX[topLeft + 1] * weightTopRight + calibrationOffsetsX[bottomLeft] * weightBottomLeft + calibrationOffsetsX[bottomLeft + 1] * weightBottomRight;
+    int32_t offsetY = calibrationOffsetsY[topLeft] * weightTopLeft + calibrationOffsetsY[topLeft + 1] * weightTopRight + calibrationOffsetsY[bottomLeft] * weightBottomLeft + calibrationOffsetsY[bottomLeft + 1] * weightBottomRight;
+
+    // Round to nearest and keep the corrected position on the sensor
+    int32_t correctedX = x + ((offsetX + 32768) >> 16);
+    int32_t correctedY = y + ((offsetY + 32768) >> 16);
+    x = correctedX < 0 ? 0 : (correctedX > frameWidth ? frameWidth : correctedX);
+    y = correctedY < 0 ? 0 : (correctedY > frameHeight ? frameHeight : correctedY);
+}
+
+void DisplaxTouch::filterTouches() {
+    applyPresenceHysteresis();
+    suppressStuckContacts();
+    applyDeadZone();
+}
+
+void DisplaxTouch::applyPresenceHysteresis() {
+    if (releaseFrames <= 1 && pressFrames <= 1) {
+        return;
     }
 
-    // Notify all registered listeners
+    bool isMatched[MAX_TOUCHES] = {};
+
+    // Match parsed contacts to tracked ones by id, starting to track new ones
+    for (uint8_t touchIndex = 0; touchIndex < touchCount; touchIndex++) {
+        int slotIndex = -1;
+        int freeSlotIndex = -1;
+        int evictSlotIndex = -1;
+
+        for (uint8_t candidateIndex = 0; candidateIndex < MAX_TOUCHES; candidateIndex++) {
+            const ContactPresence& candidate = presence[candidateIndex];
+
+            if (candidate.isUsed && candidate.point.id == touches[touchIndex].id) {
+                slotIndex = candidateIndex;
+
+                break;
+            }
+
+            if (!candidate.isUsed && freeSlotIndex < 0) {
+                freeSlotIndex = candidateIndex;
+            } else if (candidate.isUsed && candidate.missingFrames > 0 && (evictSlotIndex < 0 || candidate.missingFrames > presence[evictSlotIndex].missingFrames)) {
+                evictSlotIndex = candidateIndex;
+            }
+        }
+
+        // All slots busy: a real contact takes precedence over the longest missing held one
+        if (slotIndex < 0) {
+            slotIndex = freeSlotIndex >= 0 ? freeSlotIndex : evictSlotIndex;
+
+            if (slotIndex < 0) {
+                continue;
+            }
+
+            presence[slotIndex] = ContactPresence {};
+            presence[slotIndex].isUsed = true;
+        }
+
+        ContactPresence& contact = presence[slotIndex];
+        contact.point = touches[touchIndex];
+        contact.missingFrames = 0;
+
+        if (contact.seenFrames < UINT8_MAX) {
+            contact.seenFrames++;
+        }
+
+        if (contact.seenFrames >= pressFrames) {
+            contact.isReported = true;
+        }
+
+        isMatched[slotIndex] = true;
+    }
+
+    // Release contacts missing for long enough, pending contacts have to start over once they go missing
+    for (uint8_t slotIndex = 0; slotIndex < MAX_TOUCHES; slotIndex++) {
+        ContactPresence& contact = presence[slotIndex];
+
+        if (!contact.isUsed || isMatched[slotIndex]) {
+            continue;
+        }
+
+        contact.seenFrames = 0;
+        contact.missingFrames++;
+
+        if (!contact.isReported || contact.missingFrames >= releaseFrames || isLifted(contact.point.id)) {
+            contact.isUsed = false;
+        }
+    }
+
+    // Reported contacts become the current touches
+    touchCount = 0;
+
+    for (uint8_t slotIndex = 0; slotIndex < MAX_TOUCHES; slotIndex++) {
+        if (presence[slotIndex].isUsed && presence[slotIndex].isReported) {
+            touches[touchCount++] = presence[slotIndex].point;
+        }
+    }
+}
+
+bool DisplaxTouch::isLifted(uint8_t id) const {
+    for (uint8_t liftedIndex = 0; liftedIndex < liftedCount; liftedIndex++) {
+        if (liftedIds[liftedIndex] == id) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DisplaxTouch::suppressStuckContacts() {
+    if (stuckTimeoutMs == 0) {
+        return;
+    }
+
+    ContactStillness nextStillness[MAX_TOUCHES] = {};
+    unsigned long nowMs = clock.millis();
+    uint8_t keptCount = 0;
+
+    for (uint8_t touchIndex = 0; touchIndex < touchCount; touchIndex++) {
+        const TouchPoint& point = touches[touchIndex];
+        ContactStillness& contact = nextStillness[touchIndex];
+        bool isTracked = false;
+
+        for (uint8_t stillnessIndex = 0; stillnessIndex < stillnessCount; stillnessIndex++) {
+            if (stillness[stillnessIndex].id == point.id) {
+                contact = stillness[stillnessIndex];
+                isTracked = true;
+
+                break;
+            }
+        }
+
+        int32_t deltaX = static_cast<int32_t>(point.x) - contact.anchorX;
+        int32_t deltaY = static_cast<int32_t>(point.y) - contact.anchorY;
+        int32_t deltaPressure = static_cast<int32_t>(point.pressure) - contact.anchorPressure;
+        uint32_t radiusSquared = static_cast<uint32_t>(stuckRadius) * stuckRadius;
+        bool isStill = static_cast<int64_t>(deltaX) * deltaX + static_cast<int64_t>(deltaY) * deltaY <= radiusSquared && abs(deltaPressure) <= STUCK_PRESSURE_TOLERANCE;
+
+        // Restart the stillness timer on any movement or pressure change, releasing a suppressed contact
+        if (!isTracked || !isStill) {
+            contact = ContactStillness {point.id, point.x, point.y, point.pressure, nowMs, false};
+        } else if (!contact.isSuppressed && nowMs - contact.stillSinceMs >= stuckTimeoutMs) {
+            contact.isSuppressed = true;
+            stuckContactCount++;
+            warn("Suppressing stuck contact %u", point.id);
+        }
+
+        if (!contact.isSuppressed) {
+            touches[keptCount++] = point;
+        }
+    }
+
+    memcpy(stillness, nextStillness, sizeof(stillness));
+    stillnessCount = touchCount;
+    touchCount = keptCount;
+}
+
+void DisplaxTouch::applyDeadZone() {
+    ContactMotion nextMotion[MAX_TOUCHES] = {};
+    uint32_t radiusSquared = static_cast<uint32_t>(deadZoneRadius) * deadZoneRadius;
+
+    for (uint8_t touchIndex = 0; touchIndex < touchCount; touchIndex++) {
+        TouchPoint& point = touches[touchIndex];
+        ContactMotion& contact = nextMotion[touchIndex];
+        bool isTracked = false;
+
+        for (uint8_t motionIndex = 0; motionIndex < motionCount; motionIndex++) {
+            if (motion[motionIndex].id == point.id) {
+                contact = motion[motionIndex];
+                isTracked = true;
+
+                break;
+            }
+        }
+
+        // New contacts start settled at their first position
+        if (!isTracked) {
+            contact = ContactMotion {point.id, point.x, point.y, point.x, point.y, 0, false};
+            point.moved = true;
+
+            continue;
+        }
+
+        int32_t deltaX = static_cast<int32_t>(point.x) - contact.anchorX;
+        int32_t deltaY = static_cast<int32_t>(point.y) - contact.anchorY;
+        // Squared distance in 64 bits, deltas span the full 16-bit coordinate range
+        bool isWithinDeadZone = static_cast<int64_t>(deltaX) * deltaX + static_cast<int64_t>(deltaY) * deltaY <= radiusSquared;
+
+        if (!contact.isMoving && isWithinDeadZone) {
+            // Resting contact: hold the dead-zone center
+            point.x = contact.anchorX;
+            point.y = contact.anchorY;
+        } else if (isWithinDeadZone) {
+            // Moving contact slowing down: keep passing changes through until it has stayed put for a few frames
+            if (++contact.stillFrames >= DEAD_ZONE_SETTLE_FRAMES) {
+                contact.isMoving = false;
+                contact.anchorX = point.x;
+                contact.anchorY = point.y;
+            }
+        } else {
+            // Left the dead-zone: track as moving and re-center on the new position
+            contact.stillFrames = 0;
+            contact.isMoving = true;
+            contact.anchorX = point.x;
+            contact.anchorY = point.y;
+        }
+
+        point.moved = point.x != contact.lastX || point.y != contact.lastY;
+        contact.lastX = point.x;
+        contact.lastY = point.y;
+    }
+
+    memcpy(motion, nextMotion, sizeof(motion));
+    motionCount = touchCount;
+}
+
+void DisplaxTouch::updateContactHistory() {
+    for (uint8_t touchIndex = 0; touchIndex < touchCount; touchIndex++) {
+        const TouchPoint& point = touches[touchIndex];
+        int historyIndex = findContactHistory(point.id);
+
+        // Start tracking new contacts in a free slot (released contacts free theirs in releaseContact())
+        if (historyIndex < 0) {
+            for (uint8_t slotIndex = 0; slotIndex < MAX_TOUCHES; slotIndex++) {
+                if (!contactHistory[slotIndex].isUsed) {
+                    historyIndex = slotIndex;
+                    contactHistory[slotIndex] = ContactHistory {};
+                    contactHistory[slotIndex].id = point.id;
+                    contactHistory[slotIndex].isUsed = true;
+                    contactHistory[slotIndex].newestIndex = KINEMATICS_SAMPLES - 1;
+
+                    break;
+                }
+            }
+
+            if (historyIndex < 0) {
+                continue;
+            }
+        }
+
+        ContactHistory& history = contactHistory[historyIndex];
+        history.newestIndex = (history.newestIndex + 1) % KINEMATICS_SAMPLES;
+        history.timesUs[history.newestIndex] = frameTimestampUs;
+        history.xs[history.newestIndex] = point.x;
+        history.ys[history.newestIndex] = point.y;
+
+        if (history.sampleCount < KINEMATICS_SAMPLES) {
+            history.sampleCount++;
+        }
+    }
+}
+
+int DisplaxTouch::findContactHistory(uint8_t id) const {
+    for (uint8_t slotIndex = 0; slotIndex < MAX_TOUCHES; slotIndex++) {
+        if (contactHistory[slotIndex].isUsed && contactHistory[slotIndex].id == id) {
+            return slotIndex;
+        }
+    }
+
+    return -1;
+}
+
+bool DisplaxTouch::estimateKinematics(const ContactHistory& history, TouchKinematics& kinematics) {
+    kinematics = TouchKinematics {};
+
+    // Least-squares sums with time in milliseconds and positions relative to the newest sample, keeping float
+    // precision independent of absolute time and position
+    unsigned long newestTimeUs = history.timesUs[history.newestIndex];
+    float newestX = history.xs[history.newestIndex];
+    float newestY = history.ys[history.newestIndex];
+    float sumT[5] = {};
+    float sumX[3] = {};
+    float sumY[3] = {};
+
+    for (uint8_t age = 0; age < history.sampleCount; age++) {
+        uint8_t sampleIndex = (history.newestIndex + KINEMATICS_SAMPLES - age) % KINEMATICS_SAMPLES;
+        unsigned long ageUs = newestTimeUs - history.timesUs[sampleIndex];
+
+        if (ageUs > KINEMATICS_MAX_AGE_US) {
+            break;
+        }
+
+        float t = -static_cast<float>(ageUs) / 1000.0f;
+        float x = history.xs[sampleIndex] - newestX;
+        float y = history.ys[sampleIndex] - newestY;
+        float power = 1.0f;
+
+        for (uint8_t exponent = 0; exponent < 5; exponent++) {
+            if (exponent < 3) {
+                sumX[exponent] += power * x;
+                sumY[exponent] += power * y;
+            }
+
+            sumT[exponent] += power;
+            power *= t;
+        }
+    }
+
+    float sampleCount = sumT[0];
+
+    if (sampleCount < 2.0f) {
+        return false;
+    }
+
+    // Quadratic fit x(t) = a + b * t + c * t^2 by Cramer's rule: velocity is b and acceleration 2c at the newest sample
+    float determinant = sumT[0] * (sumT[2] * sumT[4] - sumT[3] * sumT[3]) - sumT[1] * (sumT[1] * sumT[4] - sumT[3] * sumT[2]) + sumT[2] * (sumT[1] * sumT[3] - sumT[2] * sumT[2]);
+
+    if (sampleCount >= 4.0f && determinant > 1e-6f) {
+        float velocityX = sumT[0] * (sumX[1] * sumT[4] - sumT[3] * sumX[2]) - sumX[0] * (sumT[1] * sumT[4] - sumT[3] * sumT[2]) + sumT[2] * (sumT[1] * sumX[2] - sumX[1] * sumT[2]);
+        float velocityY = sumT[0] * (sumY[1] * sumT[4] - sumT[3] * sumY[2]) - sumY[0] * (sumT[1] * sumT[4] - sumT[3] * sumT[2]) + sumT[2] * (sumT[1] * sumY[2] - sumY[1] * sumT[2]);
+        float curvatureX = sumT[0] * (sumT[2] * sumX[2] - sumX[1] * sumT[3]) - sumT[1] * (sumT[1] * sumX[2] - sumX[1] * sumT[2]) + sumX[0] * (sumT[1] * sumT[3] - sumT[2] * sumT[2]);
+        float curvatureY = sumT[0] * (sumT[2] * sumY[2] - sumY[1] * sumT[3]) - sumT[1] * (sumT[1] * sumY[2] - sumY[1] * sumT[2]) + sumY[0] * (sumT[1] * sumT[3] - sumT[2] * sumT[2]);
+
+        // Convert from per millisecond to per second
+        kinematics.velocityX = velocityX / determinant * 1000.0f;
+        kinematics.velocityY = velocityY / determinant * 1000.0f;
+        kinematics.accelerationX = 2.0f * curvatureX / determinant * 1000000.0f;
+        kinematics.accelerationY = 2.0f * curvatureY / determinant * 1000000.0f;
+
+        return true;
+    }
+
+    // Linear fit for short histories
+    float timeVariance = sumT[2] - sumT[1] * sumT[1] / sampleCount;
+
+    if (timeVariance <= 0.0f) {
+        return false;
+    }
+
+    kinematics.velocityX = (sumX[1] - sumT[1] * sumX[0] / sampleCount) / timeVariance * 1000.0f;
+    kinematics.velocityY = (sumY[1] - sumT[1] * sumY[0] / sampleCount) / timeVariance * 1000.0f;
+
+    return true;
+}
+
+void DisplaxTouch::updateFrameInterval(uint16_t frameScanTime) {
+    unsigned long currentTimeUs = clock.micros();
+
+    // Gaps between touch sessions are not frame intervals, only sample while the previous frame had touches
+    if (previousTouchCount > 0) {
+        float arrivalIntervalUs = static_cast<float>(currentTimeUs - lastFrameTimeUs);
+
+        // Unsigned 16-bit subtraction handles scan time counter wraparound
+        float scanIntervalUs = static_cast<float>(static_cast<uint16_t>(frameScanTime - lastFrameScanTime) * SCAN_TIME_UNIT_US);
+
+        if (frameIntervalSampleCount == 0) {
+            frameArrivalIntervalUs = arrivalIntervalUs;
+            frameScanIntervalUs = scanIntervalUs;
+        } else {
+            frameArrivalIntervalUs += (arrivalIntervalUs - frameArrivalIntervalUs) * FRAME_INTERVAL_SMOOTHING;
+            frameScanIntervalUs += (scanIntervalUs - frameScanIntervalUs) * FRAME_INTERVAL_SMOOTHING;
+        }
+
+        if (frameIntervalSampleCount < UINT8_MAX) {
+            frameIntervalSampleCount++;
+        }
+    }
+
+    lastFrameTimeUs = currentTimeUs;
+    lastFrameScanTime = frameScanTime;
+}
+
+void DisplaxTouch::dispatchTouchEvents(bool isMoveReported) {
+    // Contacts missing from the current frame have been lifted
+    for (uint8_t previousIndex = 0; previousIndex < previousTouchCount; previousIndex++) {
+        bool isStillDown = false;
+
+        for (uint8_t touchIndex = 0; touchIndex < touchCount; touchIndex++) {
+            if (touches[touchIndex].id == previousTouches[previousIndex].id) {
+                isStillDown = true;
+
+                break;
+            }
+        }
+
+        if (!isStillDown) {
+            TouchPoint releasedPoint = previousTouches[previousIndex];
+            releasedPoint.active = false;
+
+            releaseContact(releasedPoint);
+        }
+    }
+
+    if (touchEventCallback) {
+        // Contacts seen in the previous frame have moved, others have just been pressed
+        for (uint8_t touchIndex = 0; touchIndex < touchCount; touchIndex++) {
+            bool wasDown = false;
+
+            for (uint8_t previousIndex = 0; previousIndex < previousTouchCount; previousIndex++) {
+                if (previousTouches[previousIndex].id == touches[touchIndex].id) {
+                    wasDown = true;
+
+                    break;
+                }
+            }
+
+            if (!wasDown) {
+                touchEventCallback(TouchEventType::Down, touches[touchIndex]);
+            } else if (isMoveReported && touches[touchIndex].moved) {
+                touchEventCallback(TouchEventType::Move, touches[touchIndex]);
+            }
+        }
+    }
+
+    // Current touches become the previous frame for the next comparison
+    memcpy(previousTouches, touches, sizeof(touches));
+    previousTouchCount = touchCount;
+}
+
+void DisplaxTouch::releaseContact(const TouchPoint& point) {
+    if (touchEventCallback) {
+        touchEventCallback(TouchEventType::Up, point);
+    }
+
+    int historyIndex = findContactHistory(point.id);
+
+    if (historyIndex < 0) {
+        return;
+    }
+
+    TouchKinematics kinematics;
+
+    if (flingCallback && estimateKinematics(contactHistory[historyIndex], kinematics)) {
+        float speedSquared = kinematics.velocityX * kinematics.velocityX + kinematics.velocityY * kinematics.velocityY;
+
+        if (speedSquared >= flingMinSpeed * flingMinSpeed) {
+            flingCallback(point, kinematics.velocityX, kinematics.velocityY);
+        }
+    }
+
+    contactHistory[historyIndex].isUsed = false;
+}
+
+void DisplaxTouch::notifyTouchListeners() {
     for (uint8_t listenerIndex = 0; listenerIndex < listenerCount; listenerIndex++) {
         listeners[listenerIndex](touches, touchCount);
     }
-
-    // Consume processed touch report
-    consumeBuffer(TOUCH_REPORT_SIZE);
 }
 
 void DisplaxTouch::processEnableReporting(uint8_t* data, size_t length) {
@@ -481,7 +1232,7 @@ void DisplaxTouch::processDisableReporting(uint8_t* data, size_t length) {
 
 void DisplaxTouch::processResetResponse(uint8_t* data, size_t length) {
     // Measure initialization time
-    unsigned long initializationTimeTakenMs = millis() - initializingStartTimeMs;
+    unsigned long initializationTimeTakenMs = clock.millis() - initializingStartTimeMs;
 
     log("Received reset response (initialization time: %lu ms)", initializationTimeTakenMs);
 
@@ -526,6 +1277,14 @@ uint16_t DisplaxTouch::getScanTime() const {
     return scanTime;
 }
 
+unsigned long DisplaxTouch::getFrameTimestamp() const {
+    return frameTimestampUs;
+}
+
+uint8_t DisplaxTouch::getTouchesAt(unsigned long timeUs, TouchPoint* output, unsigned long maxExtrapolationUs) const {
+    return resampler.getTouchesAt(timeUs, output, maxExtrapolationUs);
+}
+
 bool DisplaxTouch::isTouched() const {
     return touchCount > 0;
 }
@@ -572,18 +1331,136 @@ unsigned long DisplaxTouch::getTouchTimeout() const {
     return touchTimeoutMs;
 }
 
+void DisplaxTouch::setBacklogPolicy(TouchBacklogPolicy policy) {
+    backlogPolicy = policy;
+}
+
+TouchBacklogPolicy DisplaxTouch::getBacklogPolicy() const {
+    return backlogPolicy;
+}
+
+void DisplaxTouch::setErrorCorrection(bool enabled) {
+    isErrorCorrectionEnabled = enabled;
+}
+
+uint32_t DisplaxTouch::getCorrectedFrameCount() const {
+    return correctedFrameCount;
+}
+
+void DisplaxTouch::setPresenceHysteresis(uint8_t newReleaseFrames, uint8_t newPressFrames) {
+    releaseFrames = newReleaseFrames;
+    pressFrames = newPressFrames;
+
+    // Restart tracking from the current touches so contacts already reported stay down
+    for (size_t i = 0; i < MAX_TOUCHES; i++) {
+        presence[i] = ContactPresence {};
+
+        if (i < touchCount) {
+            presence[i].point = touches[i];
+            presence[i].seenFrames = 1;
+            presence[i].isUsed = true;
+            presence[i].isReported = true;
+        }
+    }
+}
+
+void DisplaxTouch::setDeadZone(uint16_t radius) {
+    deadZoneRadius = radius;
+}
+
+void DisplaxTouch::setCalibrationGrid(const int16_t* offsetsX, const int16_t* offsetsY) {
+    if (offsetsX == nullptr || offsetsY == nullptr) {
+        clearCalibrationGrid();
+
+        return;
+    }
+
+    memcpy(calibrationOffsetsX, offsetsX, sizeof(calibrationOffsetsX));
+    memcpy(calibrationOffsetsY, offsetsY, sizeof(calibrationOffsetsY));
+    isCalibrationEnabled = true;
+}
+
+void DisplaxTouch::clearCalibrationGrid() {
+    isCalibrationEnabled = false;
+}
+
+void DisplaxTouch::setStuckContactTimeout(unsigned long timeoutMs, uint16_t radius) {
+    // Anchors and timers measured under the old settings (or while disabled) are meaningless now
+    if (timeoutMs != stuckTimeoutMs || radius != stuckRadius) {
+        stillnessCount = 0;
+    }
+
+    stuckTimeoutMs = timeoutMs;
+    stuckRadius = radius;
+}
+
+uint8_t DisplaxTouch::getSuppressedContactCount() const {
+    uint8_t suppressedCount = 0;
+
+    for (uint8_t stillnessIndex = 0; stillnessIndex < stillnessCount; stillnessIndex++) {
+        if (stillness[stillnessIndex].isSuppressed) {
+            suppressedCount++;
+        }
+    }
+
+    return suppressedCount;
+}
+
+uint32_t DisplaxTouch::getStuckContactCount() const {
+    return stuckContactCount;
+}
+
+void DisplaxTouch::setAdaptiveTouchTimeout(bool enabled, float intervalMultiplier) {
+    isAdaptiveTouchTimeout = enabled;
+    releaseIntervals = intervalMultiplier;
+}
+
+unsigned long DisplaxTouch::getEffectiveTouchTimeout() const {
+    if (!isAdaptiveTouchTimeout || frameIntervalSampleCount < MIN_FRAME_INTERVAL_SAMPLES) {
+        return touchTimeoutMs;
+    }
+
+    // Round up so a multiplier of N always waits for at least N full frame intervals
+    unsigned long adaptiveTimeoutMs = static_cast<unsigned long>(static_cast<float>(getFrameInterval()) * releaseIntervals / 1000.0f) + 1;
+
+    return adaptiveTimeoutMs > MIN_ADAPTIVE_TIMEOUT_MS ? adaptiveTimeoutMs : MIN_ADAPTIVE_TIMEOUT_MS;
+}
+
+unsigned long DisplaxTouch::getFrameInterval() const {
+    if (frameIntervalSampleCount == 0) {
+        return 0;
+    }
+
+    // Prefer the longer estimate: arrival intervals are stretched by loop() jitter, scan intervals by dropped frames
+    float intervalUs = frameArrivalIntervalUs > frameScanIntervalUs ? frameArrivalIntervalUs : frameScanIntervalUs;
+
+    return static_cast<unsigned long>(intervalUs);
+}
+
 void DisplaxTouch::clearTouches() {
     touchCount = 0;
 
+    // Forget held, pending and moving contacts as well
+    for (size_t i = 0; i < MAX_TOUCHES; i++) {
+        presence[i] = ContactPresence {};
+    }
+
+    motionCount = 0;
+    stillnessCount = 0;
+
     // Clear all touch point state
     for (size_t i = 0; i < MAX_TOUCHES; i++) {
         touches[i] = TouchPoint {};
     }
 
-    // Notify all listeners that touches have been cleared
-    for (uint8_t listenerIndex = 0; listenerIndex < listenerCount; listenerIndex++) {
-        listeners[listenerIndex](touches, 0);
-    }
+    // Released contacts are no longer resampled. The release goes one frame interval after the last report on the same
+    // estimated time base, raw arrival time could sort it before the reports it follows.
+    unsigned long frameIntervalUs = getFrameInterval();
+    resampler.addFrame(touches, 0, frameTimestampUs + (frameIntervalUs > 0 ? frameIntervalUs : 1));
+
+    // Report any contacts still down as released and notify all listeners that touches have been cleared
+    dispatchTouchEvents();
+    notifyTouchListeners();
 }
 
 int DisplaxTouch::addTouchListener(TouchCallback callback) {
@@ -620,6 +1497,25 @@ bool DisplaxTouch::removeTouchListener(int listenerId) {
     return false;
 }
 
+void DisplaxTouch::setTouchEventCallback(TouchEventCallback callback) {
+    touchEventCallback = callback;
+}
+
+bool DisplaxTouch::getTouchKinematics(uint8_t id, TouchKinematics& kinematics) const {
+    int historyIndex = findContactHistory(id);
+
+    if (historyIndex < 0) {
+        return false;
+    }
+
+    return estimateKinematics(contactHistory[historyIndex], kinematics);
+}
+
+void DisplaxTouch::setFlingCallback(TouchFlingCallback callback, float minSpeed) {
+    flingCallback = callback;
+    flingMinSpeed = minSpeed;
+}
+
 void DisplaxTouch::setLogCallback(TouchLogCallback callback) {
     logCallback = callback;
 }
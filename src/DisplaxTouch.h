@@ -1,5 +1,10 @@
 #pragma once
 
+#include "TouchClock.h"
+#include "TouchClockSync.h"
+#include "TouchPoint.h"
+#include "TouchResampler.h"
+
 #include <Arduino.h>
 #include <functional>
 
@@ -17,20 +22,30 @@ enum class TouchOrientation {
 };
 
 /**
- * Represents a single touch point from the Displax touch sensor.
- *
- * Contains position, size, pressure information and frame dimensions for coordinate normalization.
+ * Policy for handling touch reports that queued up while loop() was not called.
+ */
+enum class TouchBacklogPolicy {
+    ProcessAll, ///< Dispatch every queued report in order (default)
+    LatestWins  ///< Dispatch only the newest intact report, skipped reports only contribute Down/Up events
+};
+
+/**
+ * Per-contact touch lifecycle event type.
  */
-struct TouchPoint {
-    uint8_t id;           // Unique touch point identifier (0-5)
-    uint16_t x;           // X coordinate in sensor units (0 to frameWidth)
-    uint16_t y;           // Y coordinate in sensor units (0 to frameHeight)
-    uint8_t width;        // Touch contact width
-    uint8_t height;       // Touch contact height
-    uint16_t pressure;    // Touch pressure value
-    uint16_t frameWidth;  // Sensor frame width for coordinate normalization
-    uint16_t frameHeight; // Sensor frame height for coordinate normalization
-    bool active;          // True if touch is currently active
+enum class TouchEventType {
+    Down, // Contact started touching the sensor
+    Move, // Contact is still down and its position changed
+    Up    // Contact lifted from the sensor
+};
+
+/**
+ * Velocity and acceleration estimate of a touch contact.
+ */
+struct TouchKinematics {
+    float velocityX;     // X velocity in sensor units per second
+    float velocityY;     // Y velocity in sensor units per second
+    float accelerationX; // X acceleration in sensor units per second squared
+    float accelerationY; // Y acceleration in sensor units per second squared
 };
 
 /**
@@ -49,6 +64,23 @@ enum class TouchLogLevel {
  */
 using TouchCallback = std::function<void(const TouchPoint* touches, uint8_t count)>;
 
+/**
+ * Callback function type for per-contact touch events.
+ *
+ * @param type Event type
+ * @param point Touch point the event applies to (last known position for Up events)
+ */
+using TouchEventCallback = std::function<void(TouchEventType type, const TouchPoint& point)>;
+
+/**
+ * Callback function type for fling gestures.
+ *
+ * @param point Touch point at the time of release
+ * @param velocityX X velocity at release in sensor units per second
+ * @param velocityY Y velocity at release in sensor units per second
+ */
+using TouchFlingCallback = std::function<void(const TouchPoint& point, float velocityX, float velocityY)>;
+
 /**
  * Callback function type for log messages.
  *
@@ -127,6 +159,9 @@ class DisplaxTouch {
      */
     using StateChangeCallback = std::function<void(TouchState newState, TouchState previousState)>;
 
+    static constexpr uint8_t CALIBRATION_COLUMNS = 9; // Calibration grid nodes across the sensor width
+    static constexpr uint8_t CALIBRATION_ROWS = 6;    // Calibration grid nodes across the sensor height
+
     /**
      * Constructs a DisplaxTouch instance.
      *
@@ -135,6 +170,18 @@ class DisplaxTouch {
      */
     DisplaxTouch(Stream& stream, TouchOrientation orientation = TouchOrientation::DEGREES_0);
 
+    /**
+     * Constructs a DisplaxTouch instance with a custom time source.
+     *
+     * All timeouts and timestamps are taken from the given clock, e.g. a VirtualTouchClock for deterministic tests or
+     * faster than real time replay of captured sensor data.
+     *
+     * @param stream Serial stream for communication with the touch sensor.
+     * @param clock Time source, must outlive the DisplaxTouch instance.
+     * @param orientation Sensor orientation for coordinate transformation (default: DEGREES_0).
+     */
+    DisplaxTouch(Stream& stream, TouchClock& clock, TouchOrientation orientation = TouchOrientation::DEGREES_0);
+
     /**
      * Initializes the touch sensor and starts the connection sequence.
      *
@@ -156,6 +203,26 @@ class DisplaxTouch {
      */
     void loop();
 
+    /**
+     * Processes incoming UART data and touch events within a time and report budget.
+     *
+     * Bounded variant of loop() for applications with hard timing requirements on the same core. Data is read and
+     * processed one report at a time until the time budget is spent, the report limit is reached or no more complete
+     * reports are available. Remaining data is kept and processed by the next call, use getBacklog() to check how
+     * much is left.
+     *
+     * @param budgetUs Time budget in microseconds (checked between reports, so a call may overrun by one report)
+     * @param maxReports Maximum number of reports to process in this call, 0 for no limit
+     */
+    void loop(unsigned long budgetUs, uint8_t maxReports = 0);
+
+    /**
+     * Gets the amount of received data not yet processed.
+     *
+     * @return Number of bytes buffered or waiting in the stream
+     */
+    size_t getBacklog();
+
     /**
      * Gets the current number of active touches.
      *
@@ -179,6 +246,30 @@ class DisplaxTouch {
      */
     uint16_t getScanTime() const;
 
+    /**
+     * Gets the host timestamp of the last touch report.
+     *
+     * Estimated from the report's scan time using an online fit of the sensor clock against frame arrival times, so
+     * it follows the sensor's actual sample spacing instead of the jittered time loop() happened to process it.
+     *
+     * @return Timestamp in microseconds in the time base of the clock's micros()
+     */
+    unsigned long getFrameTimestamp() const;
+
+    /**
+     * Gets the current touches resampled at a given time.
+     *
+     * Interpolates each contact between the recent timestamped frames (see getFrameTimestamp()), so a renderer can
+     * sample touch positions exactly at its vsync time instead of at the sensor's frame rate. Times after the newest
+     * frame are extrapolated for at most maxExtrapolationUs.
+     *
+     * @param timeUs Time to sample at in microseconds, in the time base of the clock's micros()
+     * @param output Array receiving the resampled touch points (at least 6 entries)
+     * @param maxExtrapolationUs Maximum time to extrapolate past the newest frame in microseconds
+     * @return Number of touch points written to output
+     */
+    uint8_t getTouchesAt(unsigned long timeUs, TouchPoint* output, unsigned long maxExtrapolationUs = TouchResampler::DEFAULT_MAX_EXTRAPOLATION_US) const;
+
     /**
      * Checks if any touch is currently active.
      *
@@ -213,6 +304,41 @@ class DisplaxTouch {
      */
     bool removeTouchListener(int listenerId);
 
+    /**
+     * Sets the per-contact touch event callback.
+     *
+     * Receives Down/Move/Up events derived from per-id contact status transitions between frames. Up events are
+     * reported as soon as the sensor reports a contact as lifted (or stops reporting it), the touch release timeout is
+     * only used as a fallback when the sensor stops sending frames altogether.
+     *
+     * @param callback Function to call for each contact event, or nullptr to disable
+     */
+    void setTouchEventCallback(TouchEventCallback callback);
+
+    /**
+     * Gets the velocity and acceleration of an active contact.
+     *
+     * Estimated by a least-squares fit over the contact's last few positions against their scan-time-derived frame
+     * timestamps (quadratic with enough samples, linear otherwise), which is far more accurate than differencing
+     * consecutive frames with millis().
+     *
+     * @param id Touch point identifier
+     * @param kinematics Receives the estimate
+     * @return True if the contact is active and has at least two samples, false otherwise
+     */
+    bool getTouchKinematics(uint8_t id, TouchKinematics& kinematics) const;
+
+    /**
+     * Sets the fling callback.
+     *
+     * Invoked when a contact is released while moving at least minSpeed, with its velocity at release, e.g. to start
+     * kinetic scrolling.
+     *
+     * @param callback Function to call on fling, or nullptr to disable
+     * @param minSpeed Minimum release speed in sensor units per second (default: 200)
+     */
+    void setFlingCallback(TouchFlingCallback callback, float minSpeed = DEFAULT_FLING_MIN_SPEED);
+
     /**
      * Sets the log message callback.
      *
@@ -281,11 +407,11 @@ class DisplaxTouch {
     /**
      * Sets the touch release timeout.
      *
-     * When no touch frames are received within this period after active touches,
-     * the library will automatically clear touches and notify listeners with count=0.
-     * This enables proper touch-up detection.
+     * Touch-up is normally detected immediately from the contact status reported by the sensor. This timeout is a
+     * fallback: when no touch frames are received within this period after active touches, the library will
+     * automatically clear touches and notify listeners with count=0.
      *
-     * @param timeoutMs Timeout in milliseconds (default: 200ms)
+     * @param timeoutMs Timeout in milliseconds (default: 50ms)
      */
     void setTouchTimeout(unsigned long timeoutMs);
 
@@ -296,6 +422,147 @@ class DisplaxTouch {
      */
     unsigned long getTouchTimeout() const;
 
+    /**
+     * Sets the contact presence hysteresis.
+     *
+     * A contact that vanishes from a single frame (common at high speed or near the edges) would otherwise produce a
+     * spurious Up/Down pair and break drags. With hysteresis, a contact is only released after it has been missing
+     * for releaseFrames consecutive frames (keeping its last position meanwhile), and a new contact is only reported
+     * after it has been present for pressFrames consecutive frames. The defaults of 1 report changes immediately.
+     * Contacts the sensor reports as lifted (tip switch cleared) are always released at once, the sensor sends no
+     * further reports after the last lift.
+     *
+     * @param releaseFrames Consecutive frames a contact must be missing before it is released (default: 1)
+     * @param pressFrames Consecutive frames a new contact must be present before it is reported (default: 1)
+     */
+    void setPresenceHysteresis(uint8_t releaseFrames, uint8_t pressFrames = 1);
+
+    /**
+     * Sets the micro-jitter dead-zone radius.
+     *
+     * A resting finger wiggles by a few sensor units every frame. Within the dead-zone a contact keeps its previously
+     * reported position and is marked as not moved (TouchPoint::moved is false, no Move event is emitted), so
+     * downstream consumers can skip it. Once a contact leaves the dead-zone it is tracked as moving and every position
+     * change passes through, so slow deliberate drags are not quantized. A contact settles back into the dead-zone
+     * after staying within the radius for a few frames.
+     *
+     * @param radius Dead-zone radius in sensor units (millimeters on Displax sensors), 0 to disable (default)
+     */
+    void setDeadZone(uint16_t radius);
+
+    /**
+     * Sets a distortion correction grid.
+     *
+     * Corrects nonlinear position errors (typically near the bezel) that a rotation or affine transform cannot fix.
+     * The grid has CALIBRATION_COLUMNS x CALIBRATION_ROWS nodes spread evenly over the sensor frame, from 0 to the
+     * frame width and height, and each node holds the offset to add to positions reported at that node. Offsets in
+     * between are bilinearly interpolated in fixed point. The grid is defined in sensor coordinates before the
+     * orientation transform, so it stays valid when the orientation changes.
+     *
+     * @param offsetsX X offsets in sensor units, CALIBRATION_ROWS rows of CALIBRATION_COLUMNS nodes (row-major)
+     * @param offsetsY Y offsets in sensor units, same layout as offsetsX
+     */
+    void setCalibrationGrid(const int16_t* offsetsX, const int16_t* offsetsY);
+
+    /** Disables distortion correction. */
+    void clearCalibrationGrid();
+
+    /**
+     * Enables suppression of stuck contacts.
+     *
+     * Debris or water on the glass can produce contacts that stay perfectly still with steady pressure for minutes,
+     * keeping the touch count above zero and blocking multi-touch gestures. A contact that has stayed within the
+     * radius of where it came to rest with steady pressure for longer than the timeout is flagged as stuck and removed
+     * from the touches reported to listeners (with an Up event). It is reported again as a new contact once it moves.
+     * Changing the timeout or radius releases all suppressed contacts and restarts detection.
+     *
+     * @param timeoutMs Time a contact must stay still before it is suppressed, 0 to disable (default)
+     * @param radius Movement in sensor units still considered stationary
+     */
+    void setStuckContactTimeout(unsigned long timeoutMs, uint16_t radius = DEFAULT_STUCK_RADIUS);
+
+    /**
+     * Gets the number of contacts currently suppressed as stuck.
+     *
+     * @return Number of suppressed contacts
+     */
+    uint8_t getSuppressedContactCount() const;
+
+    /**
+     * Gets the number of contacts flagged as stuck.
+     *
+     * @return Number of stuck contacts detected since construction
+     */
+    uint32_t getStuckContactCount() const;
+
+    /**
+     * Enables or disables the adaptive touch release timeout.
+     *
+     * In adaptive mode the fallback release deadline is a multiple of the measured frame interval instead of the
+     * fixed setTouchTimeout() value, giving the shortest safe release latency on sensors with different frame rates.
+     * The fixed timeout is still used until enough frame intervals have been measured.
+     *
+     * @param enabled True to derive the release timeout from the measured frame interval
+     * @param intervalMultiplier Number of frame intervals without a frame before touches are released (default: 3)
+     */
+    void setAdaptiveTouchTimeout(bool enabled, float intervalMultiplier = DEFAULT_RELEASE_INTERVALS);
+
+    /**
+     * Gets the touch release timeout currently in effect.
+     *
+     * @return Adaptive timeout in milliseconds if enabled and measured, the fixed touch timeout otherwise
+     */
+    unsigned long getEffectiveTouchTimeout() const;
+
+    /**
+     * Gets the measured interval between touch frames while touches are active.
+     *
+     * The estimate is the larger of the smoothed host arrival interval and the smoothed sensor scan time interval,
+     * so loop() scheduling jitter and dropped frames both err on the side of a longer interval.
+     *
+     * @return Estimated frame interval in microseconds, 0 until measured
+     */
+    unsigned long getFrameInterval() const;
+
+    /**
+     * Sets the policy for handling a backlog of queued touch reports.
+     *
+     * With LatestWins, when several complete touch reports are buffered only the newest intact one is dispatched to
+     * listeners, so a slow loop iteration jumps straight to the current finger positions. Contacts that went down or
+     * up in the skipped reports are still reported through the touch event callback. On RX buffer overflow the
+     * buffer is trimmed to the newest intact report instead of being discarded entirely, and the intact reports
+     * trimmed with it contribute their Down/Up transitions as well.
+     *
+     * @param policy New backlog policy (default: ProcessAll)
+     */
+    void setBacklogPolicy(TouchBacklogPolicy policy);
+
+    /**
+     * Gets the current backlog policy.
+     *
+     * @return Current backlog policy
+     */
+    TouchBacklogPolicy getBacklogPolicy() const;
+
+    /**
+     * Enables or disables single-bit error correction for touch frames.
+     *
+     * When enabled, a touch frame failing the CRC check is repaired if the mismatch matches the syndrome of a single
+     * flipped bit in the payload or CRC field, instead of dropping the frame and re-synchronizing. Useful on long cable
+     * runs where most errors are single-bit flips. Errors in the 4-byte header are not corrected, such a frame is not
+     * recognized as a touch report and is skipped by re-synchronization. Disabled by default.
+     *
+     * @param enabled True to repair single-bit errors
+     */
+    void setErrorCorrection(bool enabled);
+
+    /**
+     * Gets the number of touch frames repaired by single-bit error correction.
+     *
+     * @return Number of corrected frames since construction
+     */
+    uint32_t getCorrectedFrameCount() const;
+
   private:
     /**
      * Displax UART protocol command codes.
@@ -316,6 +583,57 @@ class DisplaxTouch {
         ENABLE_USB_REPORTING = 0xFF01,       // Enable USB touch reporting
     };
 
+    /**
+     * Presence tracking state of a single contact for hysteresis.
+     */
+    struct ContactPresence {
+        TouchPoint point;      // Last known state of the contact
+        uint8_t seenFrames;    // Consecutive frames the contact has been present (saturating)
+        uint8_t missingFrames; // Consecutive frames the contact has been missing
+        bool isUsed;           // Whether this slot tracks a contact
+        bool isReported;       // Whether the contact passed the press threshold and is reported
+    };
+
+    /**
+     * Motion tracking state of a single contact.
+     */
+    struct ContactMotion {
+        uint8_t id;          // Touch point identifier
+        uint16_t anchorX;    // X coordinate the dead-zone is centered on
+        uint16_t anchorY;    // Y coordinate the dead-zone is centered on
+        uint16_t lastX;      // Last reported x coordinate
+        uint16_t lastY;      // Last reported y coordinate
+        uint8_t stillFrames; // Consecutive frames within the dead-zone while moving
+        bool isMoving;       // Whether the contact has left the dead-zone and is tracked as moving
+    };
+
+    /**
+     * Stillness tracking state of a single contact for stuck contact detection.
+     */
+    struct ContactStillness {
+        uint8_t id;                 // Touch point identifier
+        uint16_t anchorX;           // X coordinate where the contact came to rest
+        uint16_t anchorY;           // Y coordinate where the contact came to rest
+        uint16_t anchorPressure;    // Pressure when the contact came to rest
+        unsigned long stillSinceMs; // Time the contact came to rest
+        bool isSuppressed;          // Whether the contact is flagged as stuck and hidden from listeners
+    };
+
+    static constexpr uint8_t KINEMATICS_SAMPLES = 5; // Positions per contact used for kinematics estimation
+
+    /**
+     * Timestamped position history of a single contact for kinematics estimation.
+     */
+    struct ContactHistory {
+        uint8_t id;                                // Touch point identifier
+        bool isUsed;                               // Whether this slot tracks a contact
+        uint8_t sampleCount;                       // Number of samples in the history
+        uint8_t newestIndex;                       // Index of the newest sample
+        unsigned long timesUs[KINEMATICS_SAMPLES]; // Sample timestamps
+        uint16_t xs[KINEMATICS_SAMPLES];           // Sample x coordinates
+        uint16_t ys[KINEMATICS_SAMPLES];           // Sample y coordinates
+    };
+
     // Constants
     static constexpr size_t RX_BUFFER_SIZE = 2048;                   // Stream receive buffer size
     static constexpr size_t TOUCH_REPORT_SIZE = 72;                  // Touch frame total size (4 header + 64 payload + 4 CRC)
@@ -328,38 +646,98 @@ class DisplaxTouch {
     static constexpr size_t MAX_LISTENERS = 4;                       // Maximum number of touch event listeners
     static constexpr size_t LOG_BUFFER_SIZE = 128;                   // Log message buffer size
     static constexpr unsigned long INITIALIZATION_TIMEOUT_MS = 1000; // Sensor initialization timeout
-    static constexpr unsigned long DEFAULT_TOUCH_TIMEOUT_MS = 50;    // Default touch release timeout
+    static constexpr unsigned long DEFAULT_TOUCH_TIMEOUT_MS = 50;    // Default touch release timeout (fallback only)
+    static constexpr uint8_t TOUCH_STATUS_TIP_SWITCH = 0x01;         // Contact status bit set while the contact is down
+    static constexpr unsigned long SCAN_TIME_UNIT_US = 100;          // Scan time counter resolution (HID digitizer 100us units)
+    static constexpr float FRAME_INTERVAL_SMOOTHING = 0.125f;        // EWMA weight of a new frame interval sample
+    static constexpr uint8_t MIN_FRAME_INTERVAL_SAMPLES = 4;         // Frame intervals needed before the adaptive timeout is used
+    static constexpr float DEFAULT_RELEASE_INTERVALS = 3.0f;         // Default release timeout in frame intervals
+    static constexpr unsigned long MIN_ADAPTIVE_TIMEOUT_MS = 5;      // Lower bound for the adaptive release timeout
+    static constexpr uint8_t DEAD_ZONE_SETTLE_FRAMES = 4;            // Frames within the dead-zone before a moving contact settles
+    static constexpr unsigned long KINEMATICS_MAX_AGE_US = 100000;   // Samples older than this are ignored for kinematics
+    static constexpr float DEFAULT_FLING_MIN_SPEED = 200.0f;         // Default minimum release speed for a fling
+    static constexpr uint16_t DEFAULT_STUCK_RADIUS = 2;              // Default stationary radius for stuck contacts
+    static constexpr uint16_t STUCK_PRESSURE_TOLERANCE = 2;          // Pressure change still considered steady for a stuck contact
+
+    static_assert(TouchFrame::MAX_TOUCHES == MAX_TOUCHES, "TouchFrame must hold every touch point of a sensor frame");
 
     // CRC32 lookup table for nibble-based calculation (Ethernet polynomial 0x04C11DB7)
     static const uint32_t CRC32_TABLE[16];
+    static constexpr uint32_t CRC32_INITIAL = 0xFFFFFFFF; // CRC32 initial register value
+
+    // CRC32 syndromes of single-bit errors in the 64-byte touch frame payload, indexed by bit (payload byte * 8 + bit)
+    static const uint32_t CRC32_SYNDROMES[TOUCH_PAYLOAD_SIZE * 8];
 
     // Dependencies
-    Stream& stream; // Stream for sensor communication
+    Stream& stream;                 // Stream for sensor communication
+    ArduinoTouchClock arduinoClock; // Default time source when no clock is injected
+    TouchClock& clock;              // Time source for timeouts and timestamps
 
     // State
-    TouchState state = TouchState::DISCONNECTED; // Current connection/synchronization state
-    uint8_t rxBuffer[RX_BUFFER_SIZE];            // Stream receive buffer
-    size_t rxBufferSize = 0;                     // Current position in receive buffer
-    TouchPoint touches[MAX_TOUCHES] = {};        // Array of active touch points
-    uint8_t touchCount = 0;                      // Current number of active touches
-    uint16_t frameWidth = 1050;                  // Sensor frame width (default 1050mm)
-    uint16_t frameHeight = 650;                  // Sensor frame height (default 650mm)
-    TouchOrientation orientation;                // Sensor orientation for coordinate transformation
-    TouchCallback listeners[MAX_LISTENERS] = {}; // Array of registered touch listeners
-    uint8_t listenerCount = 0;                   // Number of registered listeners
-    int listenerIds[MAX_LISTENERS] = {};         // Unique IDs for registered listeners
-    int nextListenerId = 0;                      // Next listener ID to assign
+    TouchState state = TouchState::DISCONNECTED;                       // Current connection/synchronization state
+    uint8_t rxBuffer[RX_BUFFER_SIZE];                                  // Stream receive buffer
+    size_t rxBufferSize = 0;                                           // Current position in receive buffer
+    uint32_t headFrameCrc = CRC32_INITIAL;                             // Running CRC32 of the touch frame at the start of the RX buffer
+    size_t headFrameCrcLength = 0;                                     // Number of head frame bytes already folded into headFrameCrc
+    TouchPoint touches[MAX_TOUCHES] = {};                              // Array of active touch points
+    uint8_t touchCount = 0;                                            // Current number of active touches
+    uint16_t frameWidth = 1050;                                        // Sensor frame width (default 1050mm)
+    uint16_t frameHeight = 650;                                        // Sensor frame height (default 650mm)
+    TouchOrientation orientation;                                      // Sensor orientation for coordinate transformation
+    TouchBacklogPolicy backlogPolicy = TouchBacklogPolicy::ProcessAll; // Handling of queued touch reports
+    bool isErrorCorrectionEnabled = false;                             // Whether single-bit CRC errors are repaired
+    uint32_t correctedFrameCount = 0;                                  // Number of touch frames repaired
+    TouchPoint previousTouches[MAX_TOUCHES] = {};                      // Touch points that were down in the previous frame
+    uint8_t previousTouchCount = 0;                                    // Number of touch points down in the previous frame
+    TouchCallback listeners[MAX_LISTENERS] = {};                       // Array of registered touch listeners
+    uint8_t listenerCount = 0;                                         // Number of registered listeners
+    int listenerIds[MAX_LISTENERS] = {};                               // Unique IDs for registered listeners
+    int nextListenerId = 0;                                            // Next listener ID to assign
 
     // Callbacks
     StateChangeCallback stateChangeCallback = nullptr; // State change notification callback
     TouchLogCallback logCallback = nullptr;            // Log message callback
+    TouchEventCallback touchEventCallback = nullptr;   // Per-contact touch event callback
+    TouchFlingCallback flingCallback = nullptr;        // Fling gesture callback
 
     // Timing
     unsigned long initializingStartTimeMs = 0;               // Initialization start time for timeout detection
     uint16_t scanTime = 0;                                   // Last reported scan time (sensor wire format is uint16_t)
+    TouchClockSync clockSync {SCAN_TIME_UNIT_US};            // Sensor scan time to host time mapping
+    unsigned long frameTimestampUs = 0;                      // Estimated host time of the last touch report
+    TouchResampler resampler;                                // Timestamped touch history for getTouchesAt()
     unsigned long lastTouchTimeMs = 0;                       // Time of last touch report with active touches
     unsigned long touchTimeoutMs = DEFAULT_TOUCH_TIMEOUT_MS; // Touch release timeout
     bool isTouchTimeoutFired = true;                         // Whether timeout callback has been fired
+    bool isAdaptiveTouchTimeout = false;                     // Whether the release timeout follows the frame interval
+    float releaseIntervals = DEFAULT_RELEASE_INTERVALS;      // Release timeout in frame intervals
+    unsigned long lastFrameTimeUs = 0;                       // Arrival time of the previous touch frame
+    uint16_t lastFrameScanTime = 0;                          // Scan time of the previous touch frame
+    float frameArrivalIntervalUs = 0.0f;                     // Smoothed host arrival interval between touch frames
+    float frameScanIntervalUs = 0.0f;                        // Smoothed sensor scan time interval between touch frames
+    uint8_t frameIntervalSampleCount = 0;                    // Number of frame interval samples (saturating)
+
+    // Contact filtering
+    ContactPresence presence[MAX_TOUCHES] = {};      // Per-contact presence tracking for hysteresis
+    uint8_t liftedIds[MAX_TOUCHES] = {};             // Ids the last parsed report flagged as lifted (tip switch cleared)
+    uint8_t liftedCount = 0;                         // Number of entries in liftedIds
+    uint8_t releaseFrames = 1;                       // Consecutive missing frames before a contact is released
+    uint8_t pressFrames = 1;                         // Consecutive present frames before a contact is reported
+    ContactMotion motion[MAX_TOUCHES] = {};          // Motion tracking state, in the same order as touches
+    uint8_t motionCount = 0;                         // Number of contacts in motion
+    uint16_t deadZoneRadius = 0;                     // Micro-jitter dead-zone radius in sensor units
+    ContactHistory contactHistory[MAX_TOUCHES] = {}; // Timestamped positions for kinematics estimation
+    float flingMinSpeed = DEFAULT_FLING_MIN_SPEED;   // Minimum release speed for a fling
+    ContactStillness stillness[MAX_TOUCHES] = {};    // Stillness tracking state for stuck contact detection
+    uint8_t stillnessCount = 0;                      // Number of contacts in stillness
+    unsigned long stuckTimeoutMs = 0;                // Time before a still contact is suppressed, 0 when disabled
+    uint16_t stuckRadius = DEFAULT_STUCK_RADIUS;     // Movement still considered stationary
+    uint32_t stuckContactCount = 0;                  // Number of contacts flagged as stuck
+
+    // Distortion correction
+    int16_t calibrationOffsetsX[CALIBRATION_ROWS * CALIBRATION_COLUMNS] = {}; // Grid node x offsets in sensor units
+    int16_t calibrationOffsetsY[CALIBRATION_ROWS * CALIBRATION_COLUMNS] = {}; // Grid node y offsets in sensor units
+    bool isCalibrationEnabled = false;                                        // Whether distortion correction is applied
 
     //==========================================================================
     // Logging
@@ -445,6 +823,51 @@ class DisplaxTouch {
      */
     bool isValidTouchFrame(uint8_t* data, size_t length);
 
+    /**
+     * Checks that a complete touch frame with valid header and CRC starts at the given position.
+     *
+     * Unlike verifyTouchCRC() this does not log, so it can be used to probe buffered data.
+     *
+     * @param data Buffer containing potential touch frame
+     * @param length Length of buffer
+     * @return True if an intact touch frame is present
+     */
+    bool isIntactTouchFrame(const uint8_t* data, size_t length) const;
+
+    /**
+     * Searches backwards for the newest intact touch frame in buffer.
+     *
+     * @param data Buffer to search
+     * @param length Length of buffer
+     * @return Offset of the newest intact touch frame if found, -1 otherwise
+     */
+    int findLatestTouchFrame(const uint8_t* data, size_t length) const;
+
+    /**
+     * Skips buffered touch reports that are followed by a newer intact report (LatestWins policy).
+     *
+     * Skipped reports update the contact tracking so Down/Up transitions are still emitted, but Move events and
+     * touch listeners are only triggered for the newest report.
+     */
+    void skipStaleTouchReports();
+
+    /**
+     * Updates the contact tracking from a skipped touch report and emits its Down/Up transitions.
+     *
+     * @param data Intact touch report (72 bytes)
+     */
+    void processStaleTouchReport(const uint8_t* data);
+
+    /**
+     * Replays the intact touch reports at the start of the RX buffer that are about to be discarded.
+     *
+     * Used when the buffer overflows under LatestWins and is trimmed to the newest report.
+     *
+     * @param length Number of bytes that will be discarded
+     * @return Number of reports replayed
+     */
+    size_t replayStaleTouchReports(size_t length);
+
     /**
      * Searches for frame header and synchronizes to it.
      *
@@ -473,25 +896,68 @@ class DisplaxTouch {
      */
     static uint32_t calculateCRC32(const uint8_t* data, size_t length);
 
+    /**
+     * Continues a CRC32 calculation over more data.
+     *
+     * @param crc CRC register value from a previous call (CRC32_INITIAL to start)
+     * @param data Data to fold into the CRC
+     * @param length Length of data (must be multiple of 4)
+     * @return Updated CRC32 register value
+     */
+    static uint32_t updateCRC32(uint32_t crc, const uint8_t* data, size_t length);
+
+    /**
+     * Reads the CRC32 stored in a touch frame.
+     *
+     * @param frame Complete 72-byte touch frame
+     * @return Stored CRC (little-endian, bytes 68-71)
+     */
+    static uint32_t readStoredCRC(const uint8_t* frame);
+
+    /**
+     * Folds newly received words of the touch frame at the start of the RX buffer into the running CRC.
+     *
+     * Called as bytes are ingested so the CRC cost is spread over the frame's arrival and verifying the frame once
+     * its last byte lands is O(1). Does nothing unless the buffer starts with a touch frame header.
+     */
+    void updateHeadFrameCRC();
+
     /**
      * Verifies CRC32 of a touch frame.
      *
+     * Uses the running CRC when the frame is at the start of the RX buffer, otherwise calculates it in full. If error
+     * correction is enabled, a single-bit error is repaired in place.
+     *
      * @param frame Complete 72-byte touch frame
-     * @return True if calculated CRC matches stored CRC in frame
+     * @return True if calculated CRC matches stored CRC in frame (after any repair)
      */
-    bool verifyTouchCRC(const uint8_t* frame);
+    bool verifyTouchCRC(uint8_t* frame);
+
+    /**
+     * Repairs a single-bit error in a touch frame using the CRC syndrome.
+     *
+     * @param frame Complete 72-byte touch frame, modified in place
+     * @param syndrome Calculated CRC XOR stored CRC
+     * @return True if the syndrome matched a single-bit error and the frame was repaired
+     */
+    static bool repairSingleBitError(uint8_t* frame, uint32_t syndrome);
 
     //==========================================================================
     // Data Processing
     //==========================================================================
 
+    /** Checks the initialization and touch release timeouts. */
+    void checkTimeouts();
+
     /**
      * Reads available data from stream into buffer.
      *
-     * Called from loop(). Handles timeout checking, buffer overflow protection,
-     * and dispatches to appropriate state handler.
+     * Called from loop(). Handles buffer overflow protection and dispatches to appropriate state handler.
+     *
+     * @param maxBytes Maximum number of bytes to read from the stream in this call
+     * @return True if any data was read, consumed or the state changed
      */
-    void readStreamData();
+    bool readStreamData(size_t maxBytes = RX_BUFFER_SIZE);
 
     /**
      * Processes buffered Stream data and dispatches to command handlers.
@@ -536,6 +1002,113 @@ class DisplaxTouch {
      */
     void processTouchReport(uint8_t* data, size_t length);
 
+    /**
+     * Parses touch points and scan time from a touch report payload.
+     *
+     * Replaces the current touches with the active contacts in the payload, with orientation transformation applied.
+     *
+     * @param payload Touch report payload (64 bytes following the header)
+     */
+    void parseTouchPayload(const uint8_t* payload);
+
+    /**
+     * Applies the distortion correction grid to a raw sensor position.
+     *
+     * @param x Raw x coordinate, corrected in place
+     * @param y Raw y coordinate, corrected in place
+     */
+    void correctDistortion(uint16_t& x, uint16_t& y) const;
+
+    /**
+     * Applies the contact filtering stages to freshly parsed touches.
+     *
+     * Called for every parsed report, including reports skipped by the latest-wins policy, so frame-counting filters
+     * see every frame.
+     */
+    void filterTouches();
+
+    /**
+     * Applies presence hysteresis to the parsed touches.
+     *
+     * Keeps contacts missing for fewer than releaseFrames frames at their last position and holds back new contacts
+     * until they have been present for pressFrames frames. Contacts the report explicitly flags as lifted are released
+     * immediately, only contacts that vanish without a lift are treated as dropouts.
+     */
+    void applyPresenceHysteresis();
+
+    /**
+     * Checks whether the last parsed report flagged a contact as lifted.
+     *
+     * @param id Touch point id
+     * @return True if the contact was reported with the tip switch cleared
+     */
+    bool isLifted(uint8_t id) const;
+
+    /**
+     * Flags contacts that stayed still with steady pressure beyond the stuck timeout and removes them from the
+     * touches.
+     */
+    void suppressStuckContacts();
+
+    /**
+     * Applies the micro-jitter dead-zone and sets the moved flag of each touch.
+     */
+    void applyDeadZone();
+
+    /**
+     * Appends the current touch positions to the per-contact kinematics history.
+     *
+     * Called after the frame timestamp has been estimated.
+     */
+    void updateContactHistory();
+
+    /**
+     * Finds the kinematics history slot of a contact.
+     *
+     * @param id Touch point identifier
+     * @return Slot index, -1 if the contact is not tracked
+     */
+    int findContactHistory(uint8_t id) const;
+
+    /**
+     * Estimates velocity and acceleration from a contact's history by least squares.
+     *
+     * @param history Contact history
+     * @param kinematics Receives the estimate
+     * @return True if at least two recent samples were available
+     */
+    static bool estimateKinematics(const ContactHistory& history, TouchKinematics& kinematics);
+
+    /**
+     * Handles a released contact: emits the Up event, a fling if it was moving fast enough, and frees its history.
+     *
+     * @param point Touch point at the time of release
+     */
+    void releaseContact(const TouchPoint& point);
+
+    /**
+     * Updates the smoothed frame interval estimates from a newly received touch frame.
+     *
+     * Intervals are only sampled between consecutive frames while touches are active, since the sensor does not send
+     * frames when nothing is touching it.
+     *
+     * @param frameScanTime Scan time reported in the new frame
+     */
+    void updateFrameInterval(uint16_t frameScanTime);
+
+    /**
+     * Compares the current touches against the previous frame and emits per-contact events.
+     *
+     * Contacts present in both frames produce Move if they moved, new ids produce Down and ids missing from the current
+     * frame produce Up with their last known position. The current touches then become the previous frame.
+     *
+     * @param isMoveReported False to only emit Down and Up events (used for skipped reports)
+     */
+    void dispatchTouchEvents(bool isMoveReported = true);
+
+    /** Notifies all registered touch listeners with the current touches. */
+    void notifyTouchListeners();
+
     /**
      * Processes ENABLE_REPORTING response.
      *
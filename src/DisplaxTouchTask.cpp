@@ -0,0 +1,142 @@
+#include "DisplaxTouchTask.h"
+
+#include <climits>
+
+#ifdef DISPLAX_TOUCH_FREERTOS
+
+DisplaxTouchTask::DisplaxTouchTask(DisplaxTouch& touch, UBaseType_t queueLength)
+    : touch(touch)
+    , queueLength(queueLength > 0 ? queueLength : 1) {
+}
+
+bool DisplaxTouchTask::start(UBaseType_t priority, uint32_t stackDepth, TickType_t newIdlePollTicks) {
+    if (taskHandle != nullptr) {
+        return false;
+    }
+
+    idlePollTicks = newIdlePollTicks;
+    queue = xQueueCreate(queueLength, sizeof(TouchFrame));
+
+    if (queue == nullptr) {
+        return false;
+    }
+
+    listenerId = touch.addTouchListener([this](const TouchPoint* touches, uint8_t count) {
+        enqueueFrame(touches, count);
+    });
+
+    if (listenerId < 0 || xTaskCreate(taskEntry, "DisplaxTouch", stackDepth, this, priority, &taskHandle) != pdPASS) {
+        stop();
+
+        return false;
+    }
+
+    return true;
+}
+
+void DisplaxTouchTask::stop() {
+    if (taskHandle != nullptr) {
+        vTaskDelete(taskHandle);
+        taskHandle = nullptr;
+    }
+
+    if (listenerId >= 0) {
+        touch.removeTouchListener(listenerId);
+        listenerId = -1;
+    }
+
+    if (queue != nullptr) {
+        vQueueDelete(queue);
+        queue = nullptr;
+    }
+}
+
+void DisplaxTouchTask::notify() {
+    if (taskHandle != nullptr) {
+        xTaskNotifyGive(taskHandle);
+    }
+}
+
+void DisplaxTouchTask::notifyFromISR(BaseType_t* higherPriorityTaskWoken) {
+    if (taskHandle != nullptr) {
+        vTaskNotifyGiveFromISR(taskHandle, higherPriorityTaskWoken);
+    }
+}
+
+bool DisplaxTouchTask::receive(TouchFrame& frame, TickType_t timeoutTicks) {
+    if (queue == nullptr) {
+        return false;
+    }
+
+    return xQueueReceive(queue, &frame, timeoutTicks) == pdTRUE;
+}
+
+QueueHandle_t DisplaxTouchTask::getQueue() const {
+    return queue;
+}
+
+uint32_t DisplaxTouchTask::getDroppedFrameCount() const {
+    return droppedFrameCount;
+}
+
+void DisplaxTouchTask::taskEntry(void* parameter) {
+    static_cast<DisplaxTouchTask*>(parameter)->run();
+}
+
+void DisplaxTouchTask::run() {
+    while (true) {
+        // Sleep until data arrives or a timeout needs checking, notifications received meanwhile are coalesced
+        ulTaskNotifyTake(pdTRUE, getWaitTicks());
+
+        // Process every complete report received so far, no time budget needed in a task of its own
+        touch.loop(ULONG_MAX);
+    }
+}
+
+TickType_t DisplaxTouchTask::getWaitTicks() const {
+    TickType_t waitTicks;
+
+    switch (touch.getTouchState()) {
+        case TouchState::SYNCHRONIZED:
+            // Active touches are released by the fallback timeout if frames stop arriving
+            if (!touch.isTouched()) {
+                return idlePollTicks;
+            }
+
+            waitTicks = pdMS_TO_TICKS(touch.getEffectiveTouchTimeout());
+            break;
+
+        case TouchState::INITIALIZING:
+        case TouchState::CONNECTED:
+        case TouchState::SYNCHRONIZING:
+            waitTicks = pdMS_TO_TICKS(CONNECTION_POLL_MS);
+            break;
+
+        default:
+            return idlePollTicks;
+    }
+
+    // Never sleep longer than the idle poll interval, and at least one tick so short timeouts don't busy-loop
+    if (waitTicks > idlePollTicks) {
+        waitTicks = idlePollTicks;
+    }
+
+    return waitTicks > 0 ? waitTicks : 1;
+}
+
+void DisplaxTouchTask::enqueueFrame(const TouchPoint* touches, uint8_t count) {
+    TouchFrame frame;
+    frame.assign(touches, count, touch.getFrameTimestamp());
+
+    if (xQueueSend(queue, &frame, 0) == pdTRUE) {
+        return;
+    }
+
+    // Queue full: drop the oldest frame so consumers catch up to the newest touches
+    TouchFrame oldestFrame;
+    xQueueReceive(queue, &oldestFrame, 0);
+    xQueueSend(queue, &frame, 0);
+    droppedFrameCount++;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "DisplaxTouch.h"
+
+#include <Arduino.h>
+
+// FreeRTOS headers are found under freertos/ on ESP32 and at the top level on RP2040 and the POSIX port
+#if defined(__has_include) && !defined(DISPLAX_TOUCH_NO_FREERTOS)
+#if __has_include(<freertos/FreeRTOS.h>)
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#define DISPLAX_TOUCH_FREERTOS 1
+#elif __has_include(<FreeRTOS.h>)
+#include <FreeRTOS.h>
+#include <queue.h>
+#include <task.h>
+#define DISPLAX_TOUCH_FREERTOS 1
+#endif
+#endif
+
+#ifdef DISPLAX_TOUCH_FREERTOS
+
+/**
+ * Runs DisplaxTouch in its own FreeRTOS task.
+ *
+ * Instead of polling loop() with vTaskDelay(), the task blocks until it is notified that serial data has arrived,
+ * so it uses no CPU while the sensor is idle and wakes up immediately when data comes in. Parsed frames are copied
+ * into a fixed-size queue that consumer tasks can block on. When the queue is full the oldest frame is dropped, so
+ * consumers always catch up to the newest touches.
+ *
+ * Call notify() (or notifyFromISR()) whenever the serial port has received data, for example from the ESP32
+ * HardwareSerial::onReceive() callback or a UART RX interrupt. Without a notification source, pass an idle poll
+ * interval to start() instead. While touches are active or the connection is being set up, the task also wakes up
+ * on its own so release timeouts and the initialization sequence keep working.
+ *
+ * Once started, the DisplaxTouch instance belongs to the task: listeners and callbacks run in the task context and
+ * other tasks should only use the frame queue. Compiles to nothing when FreeRTOS is not available (or
+ * DISPLAX_TOUCH_NO_FREERTOS is defined).
+ *
+ * Example usage (ESP32):
+ *
+ * @code
+ * DisplaxTouch touch(Serial1);
+ * DisplaxTouchTask touchTask(touch);
+ *
+ * void setup() {
+ *     Serial1.begin(115200, SERIAL_8N1, RX_PIN, TX_PIN);
+ *     Serial1.onReceive([]() { touchTask.notify(); });
+ *     touch.begin();
+ *     touchTask.start(5);
+ * }
+ *
+ * void consumerTask(void*) {
+ *     TouchFrame frame;
+ *     while (touchTask.receive(frame)) {
+ *         // Handle frame.touches[0..frame.count-1]
+ *     }
+ * }
+ * @endcode
+ */
+class DisplaxTouchTask {
+  public:
+    static constexpr UBaseType_t DEFAULT_QUEUE_LENGTH = 8;  // Default number of frames the queue holds
+    static constexpr uint32_t DEFAULT_STACK_DEPTH = 4096;   // Default task stack depth (units of xTaskCreate())
+    static constexpr unsigned long CONNECTION_POLL_MS = 10; // Wake-up interval while the connection is being set up
+
+    /**
+     * Constructs a touch task wrapper.
+     *
+     * @param touch Driver to run in the task, must outlive the task
+     * @param queueLength Number of frames the queue holds
+     */
+    explicit DisplaxTouchTask(DisplaxTouch& touch, UBaseType_t queueLength = DEFAULT_QUEUE_LENGTH);
+
+    /**
+     * Creates the frame queue and starts the task.
+     *
+     * @param priority Task priority
+     * @param stackDepth Task stack depth in the units xTaskCreate() expects (bytes on ESP32, words elsewhere)
+     * @param idlePollTicks Maximum time the task sleeps without a notification while idle (portMAX_DELAY to rely on
+     *                      notify() only)
+     * @return True if started, false if already running or out of memory
+     */
+    bool start(UBaseType_t priority, uint32_t stackDepth = DEFAULT_STACK_DEPTH, TickType_t idlePollTicks = portMAX_DELAY);
+
+    /**
+     * Stops the task and deletes the frame queue.
+     *
+     * Must not be called from the touch task itself or while a consumer is blocked in receive().
+     */
+    void stop();
+
+    /**
+     * Wakes the task to process received data.
+     *
+     * Call from task context, e.g. a serial receive callback.
+     */
+    void notify();
+
+    /**
+     * Wakes the task to process received data from an interrupt handler.
+     *
+     * @param higherPriorityTaskWoken Set to pdTRUE if a context switch should be requested before leaving the ISR
+     */
+    void notifyFromISR(BaseType_t* higherPriorityTaskWoken);
+
+    /**
+     * Waits for the next touch frame.
+     *
+     * @param frame Receives the frame
+     * @param timeoutTicks Maximum time to wait (default: forever)
+     * @return True if a frame was received, false on timeout or if the task is not running
+     */
+    bool receive(TouchFrame& frame, TickType_t timeoutTicks = portMAX_DELAY);
+
+    /**
+     * Gets the frame queue, e.g. to add it to a queue set.
+     *
+     * @return Queue handle, nullptr if the task is not running
+     */
+    QueueHandle_t getQueue() const;
+
+    /**
+     * Gets the number of frames dropped because the queue was full.
+     *
+     * @return Number of dropped frames since construction
+     */
+    uint32_t getDroppedFrameCount() const;
+
+  private:
+    DisplaxTouch& touch;                      // Driver run by the task
+    UBaseType_t queueLength;                  // Number of frames the queue holds
+    TickType_t idlePollTicks = portMAX_DELAY; // Maximum sleep time while idle
+    TaskHandle_t taskHandle = nullptr;        // Touch task, nullptr when not running
+    QueueHandle_t queue = nullptr;            // Frame queue, nullptr when not running
+    int listenerId = -1;                      // Touch listener feeding the queue
+    volatile uint32_t droppedFrameCount = 0;  // Number of frames dropped because the queue was full
+
+    /**
+     * FreeRTOS task entry point.
+     *
+     * @param parameter DisplaxTouchTask instance
+     */
+    static void taskEntry(void* parameter);
+
+    /** Processes received data whenever notified, never returns. */
+    void run();
+
+    /**
+     * Gets how long the task may sleep without a notification.
+     *
+     * @return Maximum sleep time in ticks
+     */
+    TickType_t getWaitTicks() const;
+
+    /**
+     * Copies a frame into the queue, dropping the oldest frame if the queue is full.
+     *
+     * @param touches Active touch points
+     * @param count Number of active touch points
+     */
+    void enqueueFrame(const TouchPoint* touches, uint8_t count);
+};
+
+#endif
\ No newline at end of file
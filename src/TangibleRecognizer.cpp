@@ -0,0 +1,263 @@
+#include "TangibleRecognizer.h"
+
+#include <math.h>
+
+TangibleRecognizer::TangibleRecognizer(uint16_t tolerance)
+    : tolerance(tolerance > 0 ? tolerance : 1) {
+    clear();
+}
+
+bool TangibleRecognizer::registerToken(uint8_t tokenId, const uint16_t* feetX, const uint16_t* feetY, uint8_t footCount) {
+    if (footCount < MIN_FEET || footCount > MAX_FEET || signatureCount >= MAX_TOKENS) {
+        return false;
+    }
+
+    Signature& signature = signatures[signatureCount];
+    signature.tokenId = tokenId;
+    signature.footCount = footCount;
+
+    float xs[MAX_FEET];
+    float ys[MAX_FEET];
+    float centroidX = 0.0f;
+    float centroidY = 0.0f;
+
+    for (uint8_t foot = 0; foot < footCount; foot++) {
+        xs[foot] = feetX[foot];
+        ys[foot] = feetY[foot];
+        centroidX += xs[foot];
+        centroidY += ys[foot];
+    }
+
+    centroidX /= footCount;
+    centroidY /= footCount;
+
+    uint8_t order[MAX_FEET];
+    describe(xs, ys, footCount, signature.distances, order);
+
+    for (uint8_t rank = 0; rank < footCount; rank++) {
+        signature.feetX[rank] = xs[order[rank]] - centroidX;
+        signature.feetY[rank] = ys[order[rank]] - centroidY;
+    }
+
+    // Insert into the hash table with linear probing
+    uint8_t distanceCount = footCount * (footCount - 1) / 2;
+    uint16_t bucketSize = tolerance * 2;
+    signature.key = makeKey(signature.distances[distanceCount - 1] / bucketSize, signature.distances[0] / bucketSize, footCount);
+
+    uint8_t slot = getSlot(signature.key);
+
+    while (hashTable[slot] != EMPTY_SLOT) {
+        slot = (slot + 1) % HASH_TABLE_SIZE;
+    }
+
+    hashTable[slot] = signatureCount;
+    signatureCount++;
+
+    return true;
+}
+
+void TangibleRecognizer::clear() {
+    signatureCount = 0;
+
+    for (uint8_t slot = 0; slot < HASH_TABLE_SIZE; slot++) {
+        hashTable[slot] = EMPTY_SLOT;
+    }
+}
+
+uint8_t TangibleRecognizer::recognize(const TouchPoint* touches, uint8_t count, TangibleToken* output, uint8_t maxTokens) const {
+    if (signatureCount == 0) {
+        return 0;
+    }
+
+    // Collect active contacts
+    uint8_t contactCount = 0;
+    uint8_t contacts[MAX_TOUCHES];
+
+    for (uint8_t touchIndex = 0; touchIndex < count && contactCount < MAX_TOUCHES; touchIndex++) {
+        if (touches[touchIndex].active) {
+            contacts[contactCount++] = touchIndex;
+        }
+    }
+
+    uint8_t tokenCount = 0;
+    uint8_t usedMask = 0;
+
+    // Try combinations of four contacts before three, so a 4-foot token is not taken apart by a 3-foot match
+    for (uint8_t footCount = MAX_FEET; footCount >= MIN_FEET; footCount--) {
+        for (uint8_t mask = 0; mask < (1 << contactCount); mask++) {
+            if (tokenCount >= maxTokens) {
+                return tokenCount;
+            }
+
+            if ((mask & usedMask) != 0 || __builtin_popcount(mask) != footCount) {
+                continue;
+            }
+
+            float xs[MAX_FEET];
+            float ys[MAX_FEET];
+            uint8_t touchIndices[MAX_FEET];
+            uint8_t foot = 0;
+
+            for (uint8_t contact = 0; contact < contactCount; contact++) {
+                if ((mask & (1 << contact)) != 0) {
+                    touchIndices[foot] = contacts[contact];
+                    xs[foot] = touches[contacts[contact]].x;
+                    ys[foot] = touches[contacts[contact]].y;
+                    foot++;
+                }
+            }
+
+            float distances[MAX_DISTANCES];
+            uint8_t order[MAX_FEET];
+            describe(xs, ys, footCount, distances, order);
+
+            int signatureIndex = findSignature(distances, footCount);
+
+            if (signatureIndex < 0) {
+                continue;
+            }
+
+            const Signature& signature = signatures[signatureIndex];
+            TangibleToken& token = output[tokenCount++];
+            usedMask |= mask;
+
+            token.tokenId = signature.tokenId;
+            token.footCount = footCount;
+            token.x = 0.0f;
+            token.y = 0.0f;
+
+            for (foot = 0; foot < footCount; foot++) {
+                token.x += xs[foot];
+                token.y += ys[foot];
+                token.touchIds[foot] = touches[touchIndices[foot]].id;
+            }
+
+            token.x /= footCount;
+            token.y /= footCount;
+
+            // Least-squares rotation between the registered and measured feet paired by rank
+            float sumDot = 0.0f;
+            float sumCross = 0.0f;
+
+            for (uint8_t rank = 0; rank < footCount; rank++) {
+                float measuredX = xs[order[rank]] - token.x;
+                float measuredY = ys[order[rank]] - token.y;
+                sumDot += signature.feetX[rank] * measuredX + signature.feetY[rank] * measuredY;
+                sumCross += signature.feetX[rank] * measuredY - signature.feetY[rank] * measuredX;
+            }
+
+            token.angle = atan2f(sumCross, sumDot);
+        }
+    }
+
+    return tokenCount;
+}
+
+void TangibleRecognizer::describe(const float* xs, const float* ys, uint8_t footCount, float* distances, uint8_t* order) {
+    float distanceSums[MAX_FEET] = {};
+    uint8_t distanceCount = 0;
+
+    for (uint8_t first = 0; first < footCount; first++) {
+        order[first] = first;
+
+        for (uint8_t second = first + 1; second < footCount; second++) {
+            float dx = xs[second] - xs[first];
+            float dy = ys[second] - ys[first];
+            float distance = sqrtf(dx * dx + dy * dy);
+
+            distances[distanceCount++] = distance;
+            distanceSums[first] += distance;
+            distanceSums[second] += distance;
+        }
+    }
+
+    // Insertion sort, at most six distances and four feet
+    for (uint8_t i = 1; i < distanceCount; i++) {
+        float value = distances[i];
+        uint8_t j = i;
+
+        for (; j > 0 && distances[j - 1] > value; j--) {
+            distances[j] = distances[j - 1];
+        }
+
+        distances[j] = value;
+    }
+
+    for (uint8_t i = 1; i < footCount; i++) {
+        uint8_t value = order[i];
+        uint8_t j = i;
+
+        for (; j > 0 && distanceSums[order[j - 1]] > distanceSums[value]; j--) {
+            order[j] = order[j - 1];
+        }
+
+        order[j] = value;
+    }
+}
+
+uint32_t TangibleRecognizer::makeKey(uint16_t longest, uint16_t shortest, uint8_t footCount) {
+    return (static_cast<uint32_t>(footCount) << 28) ^ (static_cast<uint32_t>(longest) << 14) ^ shortest;
+}
+
+uint8_t TangibleRecognizer::getSlot(uint32_t key) {
+    // Multiplicative hashing, the top bits of the 32-bit product select the slot
+    return static_cast<uint32_t>(key * 2654435761UL) >> (32 - HASH_TABLE_BITS);
+}
+
+int TangibleRecognizer::findSignature(const float* distances, uint8_t footCount) const {
+    uint8_t distanceCount = footCount * (footCount - 1) / 2;
+    float bucketSize = tolerance * 2.0f;
+
+    // A distance within the tolerance of a registered one falls into the same bucket or the adjacent bucket nearest
+    // to it, so probe both for the longest and the shortest distance
+    uint16_t longestBuckets[2];
+    uint16_t shortestBuckets[2];
+    nearestBuckets(distances[distanceCount - 1] / bucketSize, longestBuckets);
+    nearestBuckets(distances[0] / bucketSize, shortestBuckets);
+
+    for (uint8_t longestProbe = 0; longestProbe < 2; longestProbe++) {
+        for (uint8_t shortestProbe = 0; shortestProbe < 2; shortestProbe++) {
+            uint32_t key = makeKey(longestBuckets[longestProbe], shortestBuckets[shortestProbe], footCount);
+            uint8_t slot = getSlot(key);
+
+            for (uint8_t probe = 0; probe < HASH_TABLE_SIZE && hashTable[slot] != EMPTY_SLOT; probe++) {
+                const Signature& signature = signatures[hashTable[slot]];
+
+                if (signature.key == key && matches(signature, distances, footCount)) {
+                    return hashTable[slot];
+                }
+
+                slot = (slot + 1) % HASH_TABLE_SIZE;
+            }
+        }
+    }
+
+    return -1;
+}
+
+void TangibleRecognizer::nearestBuckets(float position, uint16_t* buckets) {
+    uint16_t bucket = static_cast<uint16_t>(position);
+    buckets[0] = bucket;
+
+    if (position - bucket >= 0.5f) {
+        buckets[1] = bucket + 1;
+    } else {
+        buckets[1] = bucket > 0 ? bucket - 1 : bucket;
+    }
+}
+
+bool TangibleRecognizer::matches(const Signature& signature, const float* distances, uint8_t footCount) const {
+    if (signature.footCount != footCount) {
+        return false;
+    }
+
+    uint8_t distanceCount = footCount * (footCount - 1) / 2;
+
+    for (uint8_t index = 0; index < distanceCount; index++) {
+        if (fabsf(signature.distances[index] - distances[index]) > tolerance) {
+            return false;
+        }
+    }
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <Arduino.h>
+
+/**
+ * Tangible object recognized on the sensor.
+ */
+struct TangibleToken {
+    uint8_t tokenId;     // Id the token was registered with
+    float x;             // X coordinate of the token center (centroid of its feet) in sensor units
+    float y;             // Y coordinate of the token center (centroid of its feet) in sensor units
+    float angle;         // Counterclockwise rotation relative to the registered foot layout in radians
+    uint8_t footCount;   // Number of feet (contacts) of the token
+    uint8_t touchIds[4]; // Touch point ids of the contacts forming the token (footCount entries)
+};
+
+/**
+ * Recognizes physical tokens from the constellation of their conductive feet.
+ *
+ * Each token is registered once with the layout of its three or four feet. Registration precomputes the sorted
+ * pairwise foot distances, which do not change when the token is moved or rotated, and stores the token in a small
+ * hash table keyed by its quantized longest and shortest distances. Per frame every combination of three or four
+ * contacts is hashed the same way and only the tokens found under that key are verified against the full distance
+ * signature, instead of trying every contact permutation against every token.
+ *
+ * Combinations of four contacts are matched first and each contact belongs to at most one token. The angle is only
+ * reliable for asymmetric foot layouts (each foot at a different total distance from the others), and mirrored layouts
+ * cannot be told apart since they have the same distances.
+ *
+ * Example usage:
+ *
+ * @code
+ * TangibleRecognizer tangibles;
+ * const uint16_t feetX[] = {0, 300, 0};
+ * const uint16_t feetY[] = {0, 0, 500};
+ * tangibles.registerToken(1, feetX, feetY, 3);
+ *
+ * touch.addTouchListener([](const TouchPoint* touches, uint8_t count) {
+ *     TangibleToken tokens[TangibleRecognizer::MAX_TOKENS];
+ *     uint8_t tokenCount = tangibles.recognize(touches, count, tokens, TangibleRecognizer::MAX_TOKENS);
+ * });
+ * @endcode
+ */
+class TangibleRecognizer {
+  public:
+    static constexpr uint8_t MAX_TOKENS = 8;          // Maximum number of registered tokens
+    static constexpr uint8_t MIN_FEET = 3;            // Minimum number of feet per token
+    static constexpr uint8_t MAX_FEET = 4;            // Maximum number of feet per token
+    static constexpr uint8_t MAX_TOUCHES = 6;         // Maximum simultaneous touch points supported by the protocol
+    static constexpr uint16_t DEFAULT_TOLERANCE = 24; // Default foot distance tolerance in sensor units
+
+    /**
+     * Constructs a recognizer.
+     *
+     * @param tolerance Maximum difference between a measured and a registered foot distance in sensor units
+     */
+    explicit TangibleRecognizer(uint16_t tolerance = DEFAULT_TOLERANCE);
+
+    /**
+     * Registers a token signature.
+     *
+     * Foot coordinates can use any origin, only their relative layout matters. They define the orientation reported
+     * as angle 0.
+     *
+     * @param tokenId Id reported for the token
+     * @param feetX X coordinates of the feet in sensor units
+     * @param feetY Y coordinates of the feet in sensor units
+     * @param footCount Number of feet (MIN_FEET to MAX_FEET)
+     * @return True if registered, false if the foot count is invalid or MAX_TOKENS tokens are registered
+     */
+    bool registerToken(uint8_t tokenId, const uint16_t* feetX, const uint16_t* feetY, uint8_t footCount);
+
+    /** Removes all registered tokens. */
+    void clear();
+
+    /**
+     * Recognizes tokens in a touch frame.
+     *
+     * @param touches Touch points in the frame
+     * @param count Number of touch points
+     * @param output Array receiving the recognized tokens
+     * @param maxTokens Capacity of output
+     * @return Number of tokens written to output
+     */
+    uint8_t recognize(const TouchPoint* touches, uint8_t count, TangibleToken* output, uint8_t maxTokens) const;
+
+  private:
+    static constexpr uint8_t MAX_DISTANCES = MAX_FEET * (MAX_FEET - 1) / 2; // Pairwise distances of a 4-foot token
+    static constexpr uint8_t HASH_TABLE_BITS = 4;                           // Hash table index bits
+    static constexpr uint8_t HASH_TABLE_SIZE = 1 << HASH_TABLE_BITS;        // Hash table slots (more than MAX_TOKENS)
+    static constexpr uint8_t EMPTY_SLOT = 0xFF;                             // Marks an unused hash table slot
+
+    /**
+     * Registered token signature.
+     */
+    struct Signature {
+        uint8_t tokenId;                // Id reported for the token
+        uint8_t footCount;              // Number of feet
+        uint32_t key;                   // Hash key of the quantized longest and shortest distances
+        float distances[MAX_DISTANCES]; // Sorted pairwise foot distances
+        float feetX[MAX_FEET];          // Foot x coordinates relative to the foot centroid, ordered by rank
+        float feetY[MAX_FEET];          // Foot y coordinates relative to the foot centroid, ordered by rank
+    };
+
+    uint16_t tolerance;                      // Foot distance tolerance in sensor units
+    Signature signatures[MAX_TOKENS] = {};   // Registered token signatures
+    uint8_t signatureCount = 0;              // Number of registered tokens
+    uint8_t hashTable[HASH_TABLE_SIZE] = {}; // Signature indices by key, EMPTY_SLOT when unused
+
+    /**
+     * Computes the sorted pairwise distances and the rank order of a foot constellation.
+     *
+     * Feet are ranked by the sum of their distances to the other feet, which gives the same order for a moved or
+     * rotated copy of the constellation and is used to pair measured feet with registered feet.
+     *
+     * @param xs Foot x coordinates
+     * @param ys Foot y coordinates
+     * @param footCount Number of feet
+     * @param distances Array receiving the sorted pairwise distances
+     * @param order Array receiving the foot indices ordered by rank
+     */
+    static void describe(const float* xs, const float* ys, uint8_t footCount, float* distances, uint8_t* order);
+
+    /**
+     * Computes the hash key of quantized distances.
+     *
+     * @param longest Quantized longest distance
+     * @param shortest Quantized shortest distance
+     * @param footCount Number of feet
+     * @return Hash key
+     */
+    static uint32_t makeKey(uint16_t longest, uint16_t shortest, uint8_t footCount);
+
+    /**
+     * Gets the hash table slot of a key.
+     *
+     * @param key Hash key
+     * @return Slot index
+     */
+    static uint8_t getSlot(uint32_t key);
+
+    /**
+     * Finds a registered token matching a measured constellation.
+     *
+     * @param distances Sorted pairwise distances of the constellation
+     * @param footCount Number of feet
+     * @return Signature index, -1 if no token matches
+     */
+    int findSignature(const float* distances, uint8_t footCount) const;
+
+    /**
+     * Gets the bucket of a quantized distance and the adjacent bucket nearest to it.
+     *
+     * @param position Distance divided by the bucket size
+     * @param buckets Array receiving the containing bucket and its nearest neighbor
+     */
+    static void nearestBuckets(float position, uint16_t* buckets);
+
+    /**
+     * Checks whether measured distances match a signature within the tolerance.
+     *
+     * @param signature Registered signature
+     * @param distances Sorted pairwise distances of the constellation
+     * @param footCount Number of feet
+     * @return True if all distances match
+     */
+    bool matches(const Signature& signature, const float* distances, uint8_t footCount) const;
+};
\ No newline at end of file
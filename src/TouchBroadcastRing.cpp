@@ -0,0 +1,160 @@
+#include "TouchBroadcastRing.h"
+
+#ifdef DISPLAX_TOUCH_BROADCAST
+
+TouchBroadcastRing::~TouchBroadcastRing() {
+    detach();
+}
+
+bool TouchBroadcastRing::attach(DisplaxTouch& newTouch) {
+    if (touch != nullptr) {
+        return false;
+    }
+
+    listenerId = newTouch.addTouchListener([this](const TouchPoint* touches, uint8_t count) {
+        publish(touches, count, touch->getFrameTimestamp());
+    });
+
+    if (listenerId < 0) {
+        return false;
+    }
+
+    touch = &newTouch;
+
+    return true;
+}
+
+void TouchBroadcastRing::detach() {
+    if (touch != nullptr) {
+        touch->removeTouchListener(listenerId);
+        touch = nullptr;
+        listenerId = -1;
+    }
+}
+
+void TouchBroadcastRing::publish(const TouchPoint* touches, uint8_t count, unsigned long timestampUs) {
+    uint32_t sequence = publishedCount.load(std::memory_order_relaxed);
+    slots[sequence % SLOT_COUNT].write(sequence, touches, count, timestampUs);
+    publishedCount.store(sequence + 1, std::memory_order_release);
+}
+
+int TouchBroadcastRing::addConsumer() {
+    for (uint8_t consumerIndex = 0; consumerIndex < MAX_CONSUMERS; consumerIndex++) {
+        Consumer& consumer = consumers[consumerIndex];
+        bool isRegistered = false;
+
+        if (!consumer.isRegistered.compare_exchange_strong(isRegistered, true, std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        consumer.cursor.store(publishedCount.load(std::memory_order_acquire), std::memory_order_relaxed);
+        consumer.droppedFrameCount.store(0, std::memory_order_relaxed);
+
+        return consumerIndex;
+    }
+
+    return -1;
+}
+
+void TouchBroadcastRing::removeConsumer(int consumerId) {
+    if (isRegisteredConsumer(consumerId)) {
+        consumers[consumerId].isRegistered.store(false, std::memory_order_release);
+    }
+}
+
+bool TouchBroadcastRing::read(int consumerId, TouchFrame& frame) {
+    if (!isRegisteredConsumer(consumerId)) {
+        return false;
+    }
+
+    Consumer& consumer = consumers[consumerId];
+    uint32_t cursor = consumer.cursor.load(std::memory_order_relaxed);
+    uint32_t droppedFrameCount = 0;
+    bool isRead = false;
+
+    while (true) {
+        // Differences instead of comparisons so the sequence numbers can wrap around
+        uint32_t lag = publishedCount.load(std::memory_order_acquire) - cursor;
+
+        if (lag == 0) {
+            break;
+        }
+
+        // Lapped by the producer: skip to the oldest frame still in the ring
+        if (lag > SLOT_COUNT) {
+            droppedFrameCount += lag - SLOT_COUNT;
+            cursor += lag - SLOT_COUNT;
+        }
+
+        if (copyFrame(cursor++, frame)) {
+            isRead = true;
+            break;
+        }
+
+        // Overwritten while copying, the frame is lost
+        droppedFrameCount++;
+    }
+
+    consumer.cursor.store(cursor, std::memory_order_relaxed);
+
+    // Single writer, a load and store avoids a read-modify-write that needs libatomic on cores like the Cortex-M0+
+    if (droppedFrameCount > 0) {
+        uint32_t totalDroppedFrameCount = consumer.droppedFrameCount.load(std::memory_order_relaxed) + droppedFrameCount;
+        consumer.droppedFrameCount.store(totalDroppedFrameCount, std::memory_order_relaxed);
+    }
+
+    return isRead;
+}
+
+bool TouchBroadcastRing::readLatest(int consumerId, TouchFrame& frame) {
+    if (!isRegisteredConsumer(consumerId)) {
+        return false;
+    }
+
+    Consumer& consumer = consumers[consumerId];
+    uint32_t cursor = consumer.cursor.load(std::memory_order_relaxed);
+
+    while (true) {
+        uint32_t newestCount = publishedCount.load(std::memory_order_acquire);
+
+        if (newestCount == cursor) {
+            return false;
+        }
+
+        if (copyFrame(newestCount - 1, frame)) {
+            consumer.cursor.store(newestCount, std::memory_order_relaxed);
+
+            return true;
+        }
+    }
+}
+
+uint32_t TouchBroadcastRing::getLag(int consumerId) const {
+    if (!isRegisteredConsumer(consumerId)) {
+        return 0;
+    }
+
+    return publishedCount.load(std::memory_order_acquire) - consumers[consumerId].cursor.load(std::memory_order_relaxed);
+}
+
+uint32_t TouchBroadcastRing::getDroppedFrameCount(int consumerId) const {
+    if (!isRegisteredConsumer(consumerId)) {
+        return 0;
+    }
+
+    return consumers[consumerId].droppedFrameCount.load(std::memory_order_relaxed);
+}
+
+uint32_t TouchBroadcastRing::getPublishedCount() const {
+    return publishedCount.load(std::memory_order_acquire);
+}
+
+bool TouchBroadcastRing::isRegisteredConsumer(int consumerId) const {
+    return consumerId >= 0 && consumerId < MAX_CONSUMERS && consumers[consumerId].isRegistered.load(std::memory_order_acquire);
+}
+
+bool TouchBroadcastRing::copyFrame(uint32_t sequence, TouchFrame& frame) const {
+    return slots[sequence % SLOT_COUNT].read(sequence, frame);
+}
+
+#endif
\ No newline at end of file
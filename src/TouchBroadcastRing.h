@@ -0,0 +1,179 @@
+#pragma once
+
+#include "DisplaxTouch.h"
+
+#include <Arduino.h>
+
+// Needs a hosted standard library with <atomic> (not available on AVR)
+#if defined(__has_include) && !defined(DISPLAX_TOUCH_NO_BROADCAST)
+#if __STDC_HOSTED__ && __has_include(<atomic>)
+#include "TouchSeqlock.h"
+
+#include <atomic>
+#define DISPLAX_TOUCH_BROADCAST 1
+#endif
+#endif
+
+#ifdef DISPLAX_TOUCH_BROADCAST
+
+/**
+ * Lock-free single-producer broadcast ring of touch frames with an independent cursor per consumer.
+ *
+ * An alternative to touch listeners when consumers run on other threads or tasks: listeners are called one after the
+ * other inside loop(), so one slow listener delays the UART path and every other listener. Here the driver publishes
+ * each frame once into a fixed ring of slots, and every consumer advances its own cursor at its own pace.
+ *
+ * The producer never waits for consumers. Each slot is guarded by a sequence number (odd while being written), so a
+ * consumer that falls more than SLOT_COUNT frames behind notices the overwritten slots, skips ahead to the oldest frame
+ * still in the ring and counts the skipped frames as dropped. Consumers never affect each other or the producer.
+ *
+ * There must be only one producer, and each consumer id must only be read from one thread at a time. Reading and
+ * publishing use only atomic loads and stores, so they stay lock-free on cores without atomic read-modify-write
+ * instructions such as the Cortex-M0+. Compiles to nothing without <atomic> (or when DISPLAX_TOUCH_NO_BROADCAST is
+ * defined).
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchBroadcastRing ring;
+ * ring.attach(touch);
+ *
+ * // Consumer thread
+ * int consumerId = ring.addConsumer();
+ * TouchFrame frame;
+ *
+ * while (true) {
+ *     while (ring.read(consumerId, frame)) {
+ *         // Handle frame.touches[0..frame.count-1]
+ *     }
+ * }
+ * @endcode
+ */
+class TouchBroadcastRing {
+  public:
+    static constexpr uint8_t SLOT_COUNT = 16;   // Number of frames kept, a consumer may lag this far without drops
+    static constexpr uint8_t MAX_CONSUMERS = 4; // Maximum number of simultaneous consumers
+
+    TouchBroadcastRing() = default;
+    ~TouchBroadcastRing();
+
+    TouchBroadcastRing(const TouchBroadcastRing&) = delete;
+    TouchBroadcastRing& operator=(const TouchBroadcastRing&) = delete;
+
+    /**
+     * Publishes every touch frame of a driver.
+     *
+     * @param touch Driver to publish, must outlive the attachment
+     * @return True if attached, false if already attached or the driver has no free listener slot
+     */
+    bool attach(DisplaxTouch& touch);
+
+    /** Stops publishing the attached driver's frames. */
+    void detach();
+
+    /**
+     * Publishes a touch frame (producer only).
+     *
+     * @param touches Active touch points
+     * @param count Number of active touch points
+     * @param timestampUs Time the frame was sampled at in microseconds
+     */
+    void publish(const TouchPoint* touches, uint8_t count, unsigned long timestampUs);
+
+    /**
+     * Registers a consumer, which starts reading with the next published frame.
+     *
+     * Safe to call from any thread while frames are being published.
+     *
+     * @return Consumer id (>= 0), -1 if MAX_CONSUMERS are registered
+     */
+    int addConsumer();
+
+    /**
+     * Unregisters a consumer.
+     *
+     * @param consumerId Id returned by addConsumer()
+     */
+    void removeConsumer(int consumerId);
+
+    /**
+     * Reads the consumer's next unread frame.
+     *
+     * @param consumerId Id returned by addConsumer()
+     * @param frame Receives the frame
+     * @return True if a frame was read, false if the consumer is up to date or the id is invalid
+     */
+    bool read(int consumerId, TouchFrame& frame);
+
+    /**
+     * Reads the newest frame, skipping the consumer's unread older frames without counting them as dropped.
+     *
+     * @param consumerId Id returned by addConsumer()
+     * @param frame Receives the frame
+     * @return True if a new frame was read, false if the consumer is up to date or the id is invalid
+     */
+    bool readLatest(int consumerId, TouchFrame& frame);
+
+    /**
+     * Gets the number of frames published but not yet read by a consumer.
+     *
+     * @param consumerId Id returned by addConsumer()
+     * @return Unread frames, may exceed SLOT_COUNT until the consumer's next read() accounts the drops
+     */
+    uint32_t getLag(int consumerId) const;
+
+    /**
+     * Gets the number of frames a consumer lost by falling more than SLOT_COUNT frames behind.
+     *
+     * @param consumerId Id returned by addConsumer()
+     * @return Dropped frames since the consumer was added
+     */
+    uint32_t getDroppedFrameCount(int consumerId) const;
+
+    /**
+     * Gets the number of frames published.
+     *
+     * @return Sequence number of the next frame (wraps around)
+     */
+    uint32_t getPublishedCount() const;
+
+  private:
+    static constexpr size_t CACHE_LINE_SIZE = 64; // Alignment keeping producer and consumer state on separate lines
+
+    /** Frame slot, 32-bit sequences stay lock-free on 32-bit cores and wrap around. */
+    using Slot = TouchSeqlockSlot<uint32_t>;
+
+    /**
+     * Per-consumer cursor, written only by the consumer itself.
+     */
+    struct alignas(CACHE_LINE_SIZE) Consumer {
+        std::atomic<bool> isRegistered;          // Whether the consumer id is in use
+        std::atomic<uint32_t> cursor;            // Sequence number of the next frame to read
+        std::atomic<uint32_t> droppedFrameCount; // Frames overwritten before they were read, written only by the consumer
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> publishedCount{0}; // Number of frames published (wraps around)
+    Slot slots[SLOT_COUNT] = {};                                      // Frame slots, frame n is stored in slot n % SLOT_COUNT
+    Consumer consumers[MAX_CONSUMERS] = {};                           // Consumer cursors
+    DisplaxTouch* touch = nullptr;                                    // Attached driver
+    int listenerId = -1;                                              // Listener publishing the attached driver's frames
+
+    /**
+     * Checks whether a consumer id is registered.
+     *
+     * @param consumerId Consumer id
+     * @return True if the id is in range and registered
+     */
+    bool isRegisteredConsumer(int consumerId) const;
+
+    /**
+     * Copies a frame out of its slot if the slot still holds that frame.
+     *
+     * @param sequence Sequence number of the frame
+     * @param frame Receives the frame
+     * @return True if copied consistently, false if the producer has overwritten (or is overwriting) the slot
+     */
+    bool copyFrame(uint32_t sequence, TouchFrame& frame) const;
+};
+
+#endif
\ No newline at end of file
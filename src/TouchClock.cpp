@@ -0,0 +1,31 @@
+#include "TouchClock.h"
+
+#include <Arduino.h>
+
+unsigned long ArduinoTouchClock::millis() {
+    return ::millis();
+}
+
+unsigned long ArduinoTouchClock::micros() {
+    return ::micros();
+}
+
+VirtualTouchClock::VirtualTouchClock(uint64_t startTimeUs)
+    : timeUs(startTimeUs) {
+}
+
+unsigned long VirtualTouchClock::millis() {
+    return static_cast<unsigned long>(timeUs / 1000);
+}
+
+unsigned long VirtualTouchClock::micros() {
+    return static_cast<unsigned long>(timeUs);
+}
+
+void VirtualTouchClock::advance(uint64_t durationUs) {
+    timeUs += durationUs;
+}
+
+void VirtualTouchClock::setTime(uint64_t newTimeUs) {
+    timeUs = newTimeUs;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Time source used by DisplaxTouch for timeouts and timestamps.
+ *
+ * Implement this to drive the driver from a different clock, for example a virtual clock when replaying captured
+ * sensor data on a host faster than real time.
+ */
+class TouchClock {
+  public:
+    virtual ~TouchClock() = default;
+
+    /**
+     * Gets the current time in milliseconds.
+     *
+     * @return Milliseconds since an arbitrary epoch (wraps around like Arduino millis())
+     */
+    virtual unsigned long millis() = 0;
+
+    /**
+     * Gets the current time in microseconds.
+     *
+     * @return Microseconds since the same epoch as millis() (wraps around like Arduino micros())
+     */
+    virtual unsigned long micros() = 0;
+};
+
+/**
+ * Clock backed by the Arduino millis() and micros() functions (default).
+ */
+class ArduinoTouchClock : public TouchClock {
+  public:
+    unsigned long millis() override;
+    unsigned long micros() override;
+};
+
+/**
+ * Manually advanced clock for deterministic tests and replay.
+ *
+ * Time only moves when advance() or setTime() is called, so timeout logic can be exercised exactly and captured
+ * sessions can be replayed at any speed.
+ *
+ * Example usage:
+ *
+ * @code
+ * VirtualTouchClock clock;
+ * DisplaxTouch touch(replayStream, clock);
+ *
+ * clock.advance(5000); // 5 ms pass
+ * touch.loop();
+ * @endcode
+ */
+class VirtualTouchClock : public TouchClock {
+  public:
+    /**
+     * Constructs a virtual clock.
+     *
+     * @param startTimeUs Initial time in microseconds
+     */
+    explicit VirtualTouchClock(uint64_t startTimeUs = 0);
+
+    unsigned long millis() override;
+    unsigned long micros() override;
+
+    /**
+     * Moves the clock forward.
+     *
+     * @param durationUs Time to advance in microseconds
+     */
+    void advance(uint64_t durationUs);
+
+    /**
+     * Sets the absolute clock time.
+     *
+     * @param timeUs New time in microseconds
+     */
+    void setTime(uint64_t timeUs);
+
+  private:
+    uint64_t timeUs; // Current time in microseconds (64-bit so millis() keeps counting after micros() wraps)
+};
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "TouchClockSync.h"
+
+TouchClockSync::TouchClockSync(unsigned long scanTimeUnitUs)
+    : scanTimeUnitUs(scanTimeUnitUs) {
+}
+
+void TouchClockSync::reset() {
+    sampleCount = 0;
+    meanSensorUs = 0.0f;
+    meanHostUs = 0.0f;
+    varianceSensor = 0.0f;
+    covariance = 0.0f;
+}
+
+unsigned long TouchClockSync::update(uint16_t scanTime, unsigned long hostTimeUs) {
+    // The first sample becomes the regression origin
+    if (sampleCount == 0) {
+        reset();
+
+        lastScanTime = scanTime;
+        lastHostUs = hostTimeUs;
+        sampleCount = 1;
+
+        return hostTimeUs;
+    }
+
+    unsigned long hostDeltaUs = hostTimeUs - lastHostUs;
+    unsigned long scanDelta = static_cast<uint16_t>(scanTime - lastScanTime);
+    unsigned long hostDeltaTicks = hostDeltaUs / scanTimeUnitUs;
+
+    // Resolve counter wraparound by adding the whole number of periods that best matches the elapsed host time
+    if (hostDeltaTicks > scanDelta) {
+        scanDelta += (hostDeltaTicks - scanDelta + SCAN_TIME_PERIOD / 2) / SCAN_TIME_PERIOD * SCAN_TIME_PERIOD;
+    }
+
+    float sensorDeltaUs = static_cast<float>(scanDelta) * static_cast<float>(scanTimeUnitUs);
+    float hostDelta = static_cast<float>(hostDeltaUs);
+
+    // A sample far off the fitted line means the sensor counter was reset, start over from this sample
+    float residualUs = hostDelta - estimate(sensorDeltaUs);
+
+    if (residualUs > MAX_RESIDUAL_US || residualUs < -MAX_RESIDUAL_US) {
+        sampleCount = 0;
+
+        return update(scanTime, hostTimeUs);
+    }
+
+    // Move the origin to the new sample so the regression state stays small enough for float precision
+    meanSensorUs -= sensorDeltaUs;
+    meanHostUs -= hostDelta;
+    lastScanTime = scanTime;
+    lastHostUs = hostTimeUs;
+
+    // Exponentially weighted update of means, variance and covariance with the new sample at the origin
+    float sensorDeviation = -meanSensorUs;
+    float hostDeviation = -meanHostUs;
+
+    meanSensorUs += SMOOTHING * sensorDeviation;
+    meanHostUs += SMOOTHING * hostDeviation;
+    varianceSensor = (1.0f - SMOOTHING) * (varianceSensor + SMOOTHING * sensorDeviation * sensorDeviation);
+    covariance = (1.0f - SMOOTHING) * (covariance + SMOOTHING * sensorDeviation * hostDeviation);
+
+    if (sampleCount < UINT8_MAX) {
+        sampleCount++;
+    }
+
+    return hostTimeUs + static_cast<long>(estimate(0.0f));
+}
+
+unsigned long TouchClockSync::toHostTime(uint16_t scanTime) const {
+    if (sampleCount == 0) {
+        return 0;
+    }
+
+    // Signed delta so scan times shortly before the latest sample map correctly too
+    int16_t scanDelta = static_cast<int16_t>(scanTime - lastScanTime);
+
+    return lastHostUs + static_cast<long>(estimate(static_cast<float>(scanDelta) * static_cast<float>(scanTimeUnitUs)));
+}
+
+float TouchClockSync::getRate() const {
+    if (!isSynchronized() || varianceSensor <= 0.0f) {
+        return 1.0f;
+    }
+
+    float rate = covariance / varianceSensor;
+
+    if (rate < MIN_RATE) {
+        return MIN_RATE;
+    }
+
+    if (rate > MAX_RATE) {
+        return MAX_RATE;
+    }
+
+    return rate;
+}
+
+bool TouchClockSync::isSynchronized() const {
+    return sampleCount >= MIN_SAMPLES;
+}
+
+float TouchClockSync::estimate(float sensorUs) const {
+    return meanHostUs + getRate() * (sensorUs - meanSensorUs);
+}
\ No newline at end of file
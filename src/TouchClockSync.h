@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Maps the sensor's 16-bit scan time counter to host timestamps.
+ *
+ * Host arrival times of touch frames are jittered by UART transfer and loop() scheduling, while the sensor scan time
+ * is sampled on the sensor's own clock. This estimator fits host time against unwrapped sensor time with an online,
+ * exponentially weighted linear regression, so each frame can be given a precise host timestamp that follows the
+ * sensor's sample spacing and compensates for drift between the two clocks.
+ *
+ * Counter wraparound is resolved using the host time elapsed between samples, so gaps between touch sessions longer
+ * than one counter period are handled as well. A sensor counter reset is detected as a large residual and restarts
+ * the estimate.
+ */
+class TouchClockSync {
+  public:
+    /**
+     * Constructs a clock synchronization estimator.
+     *
+     * @param scanTimeUnitUs Duration of one scan time counter tick in microseconds (default: 100us HID units)
+     */
+    explicit TouchClockSync(unsigned long scanTimeUnitUs = 100);
+
+    /** Forgets all samples, the next update() starts a new estimate. */
+    void reset();
+
+    /**
+     * Adds a sample and returns the estimated host time of the frame.
+     *
+     * @param scanTime Scan time reported in the frame
+     * @param hostTimeUs Host time the frame was received in microseconds
+     * @return Estimated host time the frame was sampled at in microseconds
+     */
+    unsigned long update(uint16_t scanTime, unsigned long hostTimeUs);
+
+    /**
+     * Maps a scan time near the latest sample to host time without updating the estimate.
+     *
+     * @param scanTime Scan time within half a counter period of the latest sample
+     * @return Estimated host time in microseconds, or 0 before the first sample
+     */
+    unsigned long toHostTime(uint16_t scanTime) const;
+
+    /**
+     * Gets the estimated clock rate ratio.
+     *
+     * @return Host microseconds per sensor microsecond (1.0 until enough samples have been collected)
+     */
+    float getRate() const;
+
+    /**
+     * Checks whether enough samples have been collected for a drift estimate.
+     *
+     * @return True if the rate estimate is in use
+     */
+    bool isSynchronized() const;
+
+  private:
+    static constexpr float SMOOTHING = 0.05f;                  // Weight of a new sample in the regression
+    static constexpr uint8_t MIN_SAMPLES = 8;                  // Samples needed before the rate estimate is used
+    static constexpr float MAX_RESIDUAL_US = 100000.0f;        // Residual beyond which the sensor clock is assumed reset
+    static constexpr float MIN_RATE = 0.9f;                    // Lower bound for a plausible rate estimate
+    static constexpr float MAX_RATE = 1.1f;                    // Upper bound for a plausible rate estimate
+    static constexpr unsigned long SCAN_TIME_PERIOD = 0x10000; // Scan time counter period in ticks
+
+    unsigned long scanTimeUnitUs; // Duration of one scan time tick in microseconds
+    uint8_t sampleCount = 0;      // Number of samples in the estimate (saturating)
+    uint16_t lastScanTime = 0;    // Scan time of the latest sample
+    unsigned long lastHostUs = 0; // Host time of the latest sample, the regression origin
+
+    // Exponentially weighted regression state, relative to the latest sample (sensor and host time 0)
+    float meanSensorUs = 0.0f;   // Weighted mean sensor time
+    float meanHostUs = 0.0f;     // Weighted mean host time
+    float varianceSensor = 0.0f; // Weighted sensor time variance
+    float covariance = 0.0f;     // Weighted sensor/host time covariance
+
+    /**
+     * Estimates host time relative to the latest sample for a sensor time relative to the latest sample.
+     *
+     * @param sensorUs Sensor time relative to the latest sample in microseconds
+     * @return Host time relative to the latest sample in microseconds
+     */
+    float estimate(float sensorUs) const;
+};
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include "TouchClusterer.h"
+
+TouchClusterer::TouchClusterer(float joinDistance, float splitFactor)
+    : joinDistance(joinDistance)
+    , splitFactor(splitFactor < 1.0f ? 1.0f : splitFactor) {
+}
+
+uint8_t TouchClusterer::update(const TouchPoint* touches, uint8_t count) {
+    // Collect active contacts with the group they had in the previous frame
+    uint8_t newCount = 0;
+    uint8_t newIds[MAX_TOUCHES];
+    uint8_t previousGroups[MAX_TOUCHES];
+    float newXs[MAX_TOUCHES];
+    float newYs[MAX_TOUCHES];
+    float frameWidth = 0.0f;
+
+    for (uint8_t touchIndex = 0; touchIndex < count && newCount < MAX_TOUCHES; touchIndex++) {
+        const TouchPoint& touch = touches[touchIndex];
+
+        if (!touch.active) {
+            continue;
+        }
+
+        newIds[newCount] = touch.id;
+        previousGroups[newCount] = getGroupId(touch.id);
+        newXs[newCount] = touch.x;
+        newYs[newCount] = touch.y;
+        frameWidth = touch.frameWidth;
+        newCount++;
+    }
+
+    // Link nearby contacts, keeping previously grouped contacts linked up to the split distance
+    float joinLimit = joinDistance * frameWidth;
+    float joinLimitSquared = joinLimit * joinLimit;
+    float splitLimitSquared = joinLimitSquared * splitFactor * splitFactor;
+    uint8_t parents[MAX_TOUCHES];
+
+    for (uint8_t index = 0; index < newCount; index++) {
+        parents[index] = index;
+    }
+
+    for (uint8_t first = 0; first < newCount; first++) {
+        for (uint8_t second = first + 1; second < newCount; second++) {
+            float dx = newXs[second] - newXs[first];
+            float dy = newYs[second] - newYs[first];
+            float distanceSquared = dx * dx + dy * dy;
+            bool wasGrouped = previousGroups[first] != NO_GROUP && previousGroups[first] == previousGroups[second];
+
+            if (distanceSquared < joinLimitSquared || (wasGrouped && distanceSquared < splitLimitSquared)) {
+                parents[findRoot(parents, second)] = findRoot(parents, first);
+            }
+        }
+    }
+
+    // For each cluster, find the previous group id shared by most of its contacts
+    uint8_t roots[MAX_TOUCHES];
+    uint8_t candidateIds[MAX_TOUCHES];
+    uint8_t candidateVotes[MAX_TOUCHES];
+    uint8_t clusterCount = 0;
+
+    for (uint8_t index = 0; index < newCount; index++) {
+        uint8_t root = findRoot(parents, index);
+
+        if (root != index) {
+            continue;
+        }
+
+        roots[clusterCount] = root;
+        candidateIds[clusterCount] = NO_GROUP;
+        candidateVotes[clusterCount] = 0;
+
+        for (uint8_t member = 0; member < newCount; member++) {
+            if (previousGroups[member] == NO_GROUP || findRoot(parents, member) != root) {
+                continue;
+            }
+
+            uint8_t votes = 0;
+
+            for (uint8_t other = 0; other < newCount; other++) {
+                if (previousGroups[other] == previousGroups[member] && findRoot(parents, other) == root) {
+                    votes++;
+                }
+            }
+
+            if (votes > candidateVotes[clusterCount]) {
+                candidateIds[clusterCount] = previousGroups[member];
+                candidateVotes[clusterCount] = votes;
+            }
+        }
+
+        clusterCount++;
+    }
+
+    // Clusters with the most votes claim their ids first, the remaining clusters get new ids
+    uint8_t clusterGroupIds[MAX_TOUCHES];
+    uint8_t assignedIds[MAX_TOUCHES];
+    uint8_t assignedCount = 0;
+    bool isAssigned[MAX_TOUCHES] = {};
+
+    for (uint8_t pass = 0; pass < clusterCount; pass++) {
+        int best = -1;
+
+        for (uint8_t cluster = 0; cluster < clusterCount; cluster++) {
+            if (!isAssigned[cluster] && (best < 0 || candidateVotes[cluster] > candidateVotes[best])) {
+                best = cluster;
+            }
+        }
+
+        uint8_t groupId = candidateIds[best];
+
+        for (uint8_t assigned = 0; assigned < assignedCount; assigned++) {
+            if (assignedIds[assigned] == groupId) {
+                groupId = NO_GROUP;
+                break;
+            }
+        }
+
+        if (groupId == NO_GROUP) {
+            groupId = allocateGroupId(assignedIds, assignedCount);
+        }
+
+        clusterGroupIds[best] = groupId;
+        assignedIds[assignedCount++] = groupId;
+        isAssigned[best] = true;
+    }
+
+    // Store the frame for the next update and for the getters
+    contactCount = newCount;
+
+    for (uint8_t index = 0; index < newCount; index++) {
+        uint8_t root = findRoot(parents, index);
+
+        for (uint8_t cluster = 0; cluster < clusterCount; cluster++) {
+            if (roots[cluster] == root) {
+                groupIds[index] = clusterGroupIds[cluster];
+                break;
+            }
+        }
+
+        touchIds[index] = newIds[index];
+        xs[index] = newXs[index];
+        ys[index] = newYs[index];
+    }
+
+    return clusterCount;
+}
+
+uint8_t TouchClusterer::getGroupId(uint8_t touchId) const {
+    for (uint8_t index = 0; index < contactCount; index++) {
+        if (touchIds[index] == touchId) {
+            return groupIds[index];
+        }
+    }
+
+    return NO_GROUP;
+}
+
+uint8_t TouchClusterer::getGroups(TouchGroup* output, uint8_t maxGroups) const {
+    uint8_t groupCount = 0;
+
+    for (uint8_t index = 0; index < contactCount; index++) {
+        // Each group is emitted at its first contact
+        bool isFirst = true;
+
+        for (uint8_t previous = 0; previous < index; previous++) {
+            if (groupIds[previous] == groupIds[index]) {
+                isFirst = false;
+                break;
+            }
+        }
+
+        if (!isFirst) {
+            continue;
+        }
+
+        if (groupCount >= maxGroups) {
+            break;
+        }
+
+        TouchGroup& group = output[groupCount++];
+        group.groupId = groupIds[index];
+        group.count = 0;
+        group.centerX = 0.0f;
+        group.centerY = 0.0f;
+
+        for (uint8_t member = index; member < contactCount; member++) {
+            if (groupIds[member] == group.groupId) {
+                group.touchIds[group.count++] = touchIds[member];
+                group.centerX += xs[member];
+                group.centerY += ys[member];
+            }
+        }
+
+        group.centerX /= group.count;
+        group.centerY /= group.count;
+    }
+
+    return groupCount;
+}
+
+void TouchClusterer::reset() {
+    contactCount = 0;
+    nextGroupId = 1;
+}
+
+uint8_t TouchClusterer::findRoot(uint8_t* parents, uint8_t index) {
+    while (parents[index] != index) {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+
+    return index;
+}
+
+uint8_t TouchClusterer::allocateGroupId(const uint8_t* usedIds, uint8_t usedCount) {
+    while (true) {
+        uint8_t groupId = nextGroupId++;
+        bool isUsed = groupId == NO_GROUP;
+
+        for (uint8_t used = 0; used < usedCount && !isUsed; used++) {
+            isUsed = usedIds[used] == groupId;
+        }
+
+        if (!isUsed) {
+            return groupId;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <Arduino.h>
+
+/**
+ * Group of contacts that belong to the same hand or user.
+ */
+struct TouchGroup {
+    uint8_t groupId;     // Group id, stable across frames while the group exists
+    uint8_t count;       // Number of contacts in the group
+    uint8_t touchIds[6]; // Touch point ids of the contacts in the group (count entries)
+    float centerX;       // X coordinate of the contact centroid in sensor units
+    float centerY;       // Y coordinate of the contact centroid in sensor units
+};
+
+/**
+ * Groups contacts into hands or users.
+ *
+ * Contacts closer than a join distance are linked, and linked contacts form a group (single-linkage clustering over at
+ * most fifteen contact pairs). For temporal coherence, contacts that were grouped in the previous frame stay linked
+ * until they are further apart than a larger split distance, so a group does not flicker while fingers spread.
+ *
+ * Groups keep their id across frames: a group takes over the id most of its contacts had in the previous frame. When
+ * a group splits, the part with more of the previous contacts keeps the id and the other part gets a new one.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchClusterer clusterer;
+ *
+ * touch.addTouchListener([](const TouchPoint* touches, uint8_t count) {
+ *     TouchGroup groups[TouchClusterer::MAX_TOUCHES];
+ *     clusterer.update(touches, count);
+ *     uint8_t groupCount = clusterer.getGroups(groups, TouchClusterer::MAX_TOUCHES);
+ * });
+ * @endcode
+ */
+class TouchClusterer {
+  public:
+    static constexpr uint8_t MAX_TOUCHES = 6;             // Maximum simultaneous touch points supported by the protocol
+    static constexpr uint8_t NO_GROUP = 0;                // Group id returned for unknown contacts
+    static constexpr float DEFAULT_JOIN_DISTANCE = 0.15f; // Default join distance as a fraction of the frame width
+    static constexpr float DEFAULT_SPLIT_FACTOR = 1.5f;   // Default split distance relative to the join distance
+
+    /**
+     * Constructs a clusterer.
+     *
+     * @param joinDistance Distance below which contacts are grouped, as a fraction of the frame width
+     * @param splitFactor Multiple of the join distance beyond which grouped contacts are separated again (>= 1)
+     */
+    explicit TouchClusterer(float joinDistance = DEFAULT_JOIN_DISTANCE, float splitFactor = DEFAULT_SPLIT_FACTOR);
+
+    /**
+     * Groups the contacts of a touch frame.
+     *
+     * @param touches Touch points in the frame
+     * @param count Number of touch points (0 when all contacts have been released)
+     * @return Number of groups
+     */
+    uint8_t update(const TouchPoint* touches, uint8_t count);
+
+    /**
+     * Gets the group of a contact in the latest frame.
+     *
+     * @param touchId Touch point id
+     * @return Group id, NO_GROUP if the contact is not in the latest frame
+     */
+    uint8_t getGroupId(uint8_t touchId) const;
+
+    /**
+     * Gets the groups of the latest frame.
+     *
+     * @param output Array receiving the groups
+     * @param maxGroups Capacity of output
+     * @return Number of groups written to output
+     */
+    uint8_t getGroups(TouchGroup* output, uint8_t maxGroups) const;
+
+    /** Forgets all contacts and groups. */
+    void reset();
+
+  private:
+    float joinDistance;                 // Join distance as a fraction of the frame width
+    float splitFactor;                  // Split distance relative to the join distance
+    uint8_t contactCount = 0;           // Number of contacts in the latest frame
+    uint8_t touchIds[MAX_TOUCHES] = {}; // Touch point ids of the latest frame
+    uint8_t groupIds[MAX_TOUCHES] = {}; // Group id of each contact of the latest frame
+    float xs[MAX_TOUCHES] = {};         // Contact x coordinates of the latest frame
+    float ys[MAX_TOUCHES] = {};         // Contact y coordinates of the latest frame
+    uint8_t nextGroupId = 1;            // Next candidate for a new group id
+
+    /**
+     * Finds the root of a contact in a union-find forest.
+     *
+     * @param parents Parent index of each contact
+     * @param index Contact index
+     * @return Index of the root contact
+     */
+    static uint8_t findRoot(uint8_t* parents, uint8_t index);
+
+    /**
+     * Allocates a group id that is not in use.
+     *
+     * @param usedIds Group ids already assigned in the current frame
+     * @param usedCount Number of entries in usedIds
+     * @return New group id
+     */
+    uint8_t allocateGroupId(const uint8_t* usedIds, uint8_t usedCount);
+};
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "TouchCoroutines.h"
+
+#ifdef DISPLAX_TOUCH_COROUTINES
+
+#include <exception>
+
+// Coroutine frame slot pool shared by all TouchTask coroutines
+alignas(std::max_align_t) static uint8_t taskSlots[TouchTask::MAX_TASKS][TouchTask::SLOT_SIZE];
+static bool isTaskSlotUsed[TouchTask::MAX_TASKS] = {};
+
+void* TouchTask::promise_type::operator new(size_t size) noexcept {
+    if (size > SLOT_SIZE) {
+        return nullptr;
+    }
+
+    for (size_t slotIndex = 0; slotIndex < MAX_TASKS; slotIndex++) {
+        if (!isTaskSlotUsed[slotIndex]) {
+            isTaskSlotUsed[slotIndex] = true;
+
+            return taskSlots[slotIndex];
+        }
+    }
+
+    return nullptr;
+}
+
+void TouchTask::promise_type::operator delete(void* frame) noexcept {
+    size_t slotIndex = (static_cast<uint8_t*>(frame) - &taskSlots[0][0]) / SLOT_SIZE;
+
+    if (slotIndex < MAX_TASKS) {
+        isTaskSlotUsed[slotIndex] = false;
+    }
+}
+
+TouchTask TouchTask::promise_type::get_return_object_on_allocation_failure() noexcept {
+    return TouchTask(false);
+}
+
+TouchTask TouchTask::promise_type::get_return_object() noexcept {
+    return TouchTask(true);
+}
+
+std::suspend_never TouchTask::promise_type::initial_suspend() noexcept {
+    return {};
+}
+
+std::suspend_never TouchTask::promise_type::final_suspend() noexcept {
+    return {};
+}
+
+void TouchTask::promise_type::return_void() noexcept {
+}
+
+void TouchTask::promise_type::unhandled_exception() noexcept {
+    std::terminate();
+}
+
+TouchTask::TouchTask(bool isAllocated)
+    : isAllocated(isAllocated) {
+}
+
+bool TouchTask::isStarted() const {
+    return isAllocated;
+}
+
+TouchCoroutines::FrameAwaiter::FrameAwaiter(TouchCoroutines& owner)
+    : owner(owner) {
+}
+
+bool TouchCoroutines::FrameAwaiter::await_ready() const noexcept {
+    return false;
+}
+
+void TouchCoroutines::FrameAwaiter::await_suspend(std::coroutine_handle<> newHandle) noexcept {
+    handle = newHandle;
+    next = nullptr;
+
+    // Append so coroutines are resumed in the order they started waiting
+    FrameAwaiter** tail = &owner.frameWaiters;
+
+    while (*tail != nullptr) {
+        tail = &(*tail)->next;
+    }
+
+    *tail = this;
+}
+
+TouchFrame TouchCoroutines::FrameAwaiter::await_resume() const noexcept {
+    return frame;
+}
+
+TouchCoroutines::EventAwaiter::EventAwaiter(TouchCoroutines& owner, bool isAnyType, TouchEventType type)
+    : owner(owner)
+    , isAnyType(isAnyType)
+    , type(type) {
+}
+
+bool TouchCoroutines::EventAwaiter::await_ready() const noexcept {
+    return false;
+}
+
+void TouchCoroutines::EventAwaiter::await_suspend(std::coroutine_handle<> newHandle) noexcept {
+    handle = newHandle;
+    next = nullptr;
+
+    EventAwaiter** tail = &owner.eventWaiters;
+
+    while (*tail != nullptr) {
+        tail = &(*tail)->next;
+    }
+
+    *tail = this;
+}
+
+TouchEvent TouchCoroutines::EventAwaiter::await_resume() const noexcept {
+    return event;
+}
+
+TouchCoroutines::TouchCoroutines(DisplaxTouch& touch)
+    : touch(touch) {
+    listenerId = touch.addTouchListener([this](const TouchPoint* touches, uint8_t count) {
+        dispatchFrame(touches, count);
+    });
+
+    touch.setTouchEventCallback([this](TouchEventType type, const TouchPoint& point) {
+        dispatchEvent(type, point);
+    });
+}
+
+TouchCoroutines::~TouchCoroutines() {
+    touch.removeTouchListener(listenerId);
+    touch.setTouchEventCallback(nullptr);
+
+    // Destroying a coroutine also destroys the awaiter in its frame, so advance before destroying
+    while (frameWaiters != nullptr) {
+        FrameAwaiter* waiter = frameWaiters;
+        frameWaiters = waiter->next;
+        waiter->handle.destroy();
+    }
+
+    while (eventWaiters != nullptr) {
+        EventAwaiter* waiter = eventWaiters;
+        eventWaiters = waiter->next;
+        waiter->handle.destroy();
+    }
+}
+
+TouchCoroutines::FrameAwaiter TouchCoroutines::nextFrame() {
+    return FrameAwaiter(*this);
+}
+
+TouchCoroutines::EventAwaiter TouchCoroutines::nextEvent() {
+    return EventAwaiter(*this, true, TouchEventType::Down);
+}
+
+TouchCoroutines::EventAwaiter TouchCoroutines::nextEvent(TouchEventType type) {
+    return EventAwaiter(*this, false, type);
+}
+
+void TouchCoroutines::setTouchEventCallback(TouchEventCallback callback) {
+    touchEventCallback = callback;
+}
+
+void TouchCoroutines::dispatchFrame(const TouchPoint* touches, uint8_t count) {
+    TouchFrame frame = {};
+    frame.assign(touches, count, touch.getFrameTimestamp());
+
+    // Detach the list first: resumed coroutines that await the next frame register for the next dispatch
+    FrameAwaiter* waiters = frameWaiters;
+    frameWaiters = nullptr;
+
+    while (waiters != nullptr) {
+        FrameAwaiter* waiter = waiters;
+        waiters = waiter->next;
+        waiter->frame = frame;
+        waiter->handle.resume();
+    }
+}
+
+void TouchCoroutines::dispatchEvent(TouchEventType type, const TouchPoint& point) {
+    EventAwaiter* waiters = eventWaiters;
+    eventWaiters = nullptr;
+
+    while (waiters != nullptr) {
+        EventAwaiter* waiter = waiters;
+        waiters = waiter->next;
+
+        if (waiter->isAnyType || waiter->type == type) {
+            waiter->event = TouchEvent {type, point};
+            waiter->handle.resume();
+        } else {
+            // Keep waiting, re-registering puts it behind awaits added by resumed coroutines
+            waiter->await_suspend(waiter->handle);
+        }
+    }
+
+    if (touchEventCallback != nullptr) {
+        touchEventCallback(type, point);
+    }
+}
+
+#endif
\ No newline at end of file
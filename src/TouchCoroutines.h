@@ -0,0 +1,226 @@
+#pragma once
+
+#include "DisplaxTouch.h"
+
+#include <Arduino.h>
+
+// Coroutines need compiler support (C++20, or -fcoroutines on older GCC) and a hosted standard library
+#if defined(__has_include) && !defined(DISPLAX_TOUCH_NO_COROUTINES)
+#if defined(__cpp_impl_coroutine) && __STDC_HOSTED__ && __has_include(<coroutine>)
+#include <coroutine>
+#include <cstddef>
+#define DISPLAX_TOUCH_COROUTINES 1
+#endif
+#endif
+
+#ifdef DISPLAX_TOUCH_COROUTINES
+
+/**
+ * Per-contact touch event delivered to a coroutine.
+ */
+struct TouchEvent {
+    TouchEventType type; // Event type
+    TouchPoint point;    // Touch point the event applies to (last known position for Up events)
+};
+
+/**
+ * Return type of touch handling coroutines.
+ *
+ * A TouchTask starts running immediately and frees its coroutine frame when it returns. Frames are allocated from a
+ * fixed pool of MAX_TASKS slots of SLOT_SIZE bytes instead of the heap. If no slot is free or the frame is larger than
+ * a slot, the coroutine does not run and isStarted() returns false.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchTask trackTaps(TouchCoroutines& touch) {
+ *     while (true) {
+ *         TouchEvent down = co_await touch.nextEvent(TouchEventType::Down);
+ *         TouchEvent up = co_await touch.nextEvent(TouchEventType::Up);
+ *         printf("Tap %u from %u,%u to %u,%u\n", down.point.id, down.point.x, down.point.y, up.point.x, up.point.y);
+ *     }
+ * }
+ * @endcode
+ */
+class TouchTask {
+  public:
+    static constexpr size_t MAX_TASKS = 8;    // Number of coroutine frame slots
+    static constexpr size_t SLOT_SIZE = 1024; // Size of a coroutine frame slot in bytes
+
+    /**
+     * Coroutine promise, allocates coroutine frames from the slot pool.
+     */
+    struct promise_type {
+        static void* operator new(size_t size) noexcept;
+        static void operator delete(void* frame) noexcept;
+        static TouchTask get_return_object_on_allocation_failure() noexcept;
+
+        TouchTask get_return_object() noexcept;
+        std::suspend_never initial_suspend() noexcept;
+        std::suspend_never final_suspend() noexcept;
+        void return_void() noexcept;
+        void unhandled_exception() noexcept;
+    };
+
+    /**
+     * Checks whether the coroutine got a frame slot and started.
+     *
+     * @return True if started, false if the slot pool was exhausted
+     */
+    bool isStarted() const;
+
+  private:
+    bool isAllocated; // Whether the coroutine frame was allocated
+
+    explicit TouchTask(bool isAllocated);
+};
+
+/**
+ * Coroutine interface for DisplaxTouch.
+ *
+ * Lets host-side tools write interaction logic as sequential code with co_await instead of callback state machines.
+ * Waiting coroutines are resumed from within DisplaxTouch::loop() when a frame or event arrives, so no extra threads
+ * are involved. Awaiting does not allocate: each pending await is linked into a waiting list through the awaiter
+ * object that lives in the coroutine frame.
+ *
+ * Uses a touch listener and takes over the touch event callback of the driver; use setTouchEventCallback() of this
+ * class to still receive events through a callback. Compiles to nothing without C++20 coroutine support (or when
+ * DISPLAX_TOUCH_NO_COROUTINES is defined).
+ *
+ * Example usage:
+ *
+ * @code
+ * DisplaxTouch touch(serialPort);
+ * TouchCoroutines touchAsync(touch);
+ *
+ * TouchTask followFirstFinger(TouchCoroutines& touch) {
+ *     while (true) {
+ *         TouchFrame frame = co_await touch.nextFrame();
+ *         if (frame.count > 0) {
+ *             moveCursor(frame.touches[0].x, frame.touches[0].y);
+ *         }
+ *     }
+ * }
+ *
+ * int main() {
+ *     touch.begin();
+ *     followFirstFinger(touchAsync);
+ *     while (true) {
+ *         touch.loop();
+ *     }
+ * }
+ * @endcode
+ */
+class TouchCoroutines {
+  public:
+    /**
+     * Awaitable for the next touch frame.
+     */
+    class FrameAwaiter {
+      public:
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<> handle) noexcept;
+        TouchFrame await_resume() const noexcept;
+
+      private:
+        friend class TouchCoroutines;
+
+        TouchCoroutines& owner;         // Dispatcher the await is registered with
+        std::coroutine_handle<> handle; // Suspended coroutine
+        FrameAwaiter* next = nullptr;   // Next pending frame await
+        TouchFrame frame = {};          // Frame delivered on resume
+
+        explicit FrameAwaiter(TouchCoroutines& owner);
+    };
+
+    /**
+     * Awaitable for the next touch event.
+     */
+    class EventAwaiter {
+      public:
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<> handle) noexcept;
+        TouchEvent await_resume() const noexcept;
+
+      private:
+        friend class TouchCoroutines;
+
+        TouchCoroutines& owner;         // Dispatcher the await is registered with
+        std::coroutine_handle<> handle; // Suspended coroutine
+        EventAwaiter* next = nullptr;   // Next pending event await
+        bool isAnyType;                 // Whether any event type resumes the await
+        TouchEventType type;            // Event type that resumes the await
+        TouchEvent event = {};          // Event delivered on resume
+
+        EventAwaiter(TouchCoroutines& owner, bool isAnyType, TouchEventType type);
+    };
+
+    /**
+     * Attaches to a driver.
+     *
+     * @param touch Driver delivering frames and events, must outlive this instance
+     */
+    explicit TouchCoroutines(DisplaxTouch& touch);
+
+    /**
+     * Detaches from the driver and destroys all coroutines still waiting for a frame or event.
+     */
+    ~TouchCoroutines();
+
+    TouchCoroutines(const TouchCoroutines&) = delete;
+    TouchCoroutines& operator=(const TouchCoroutines&) = delete;
+
+    /**
+     * Waits for the next touch frame.
+     *
+     * @return Awaitable resuming with the frame's active touch points
+     */
+    FrameAwaiter nextFrame();
+
+    /**
+     * Waits for the next touch event of any type.
+     *
+     * @return Awaitable resuming with the event
+     */
+    EventAwaiter nextEvent();
+
+    /**
+     * Waits for the next touch event of the given type.
+     *
+     * @param type Event type to wait for
+     * @return Awaitable resuming with the event
+     */
+    EventAwaiter nextEvent(TouchEventType type);
+
+    /**
+     * Sets a callback that receives every touch event after waiting coroutines have been resumed.
+     *
+     * @param callback Function to call for each event, or nullptr to disable
+     */
+    void setTouchEventCallback(TouchEventCallback callback);
+
+  private:
+    DisplaxTouch& touch;                             // Driver delivering frames and events
+    int listenerId = -1;                             // Touch listener delivering frames
+    FrameAwaiter* frameWaiters = nullptr;            // Pending frame awaits
+    EventAwaiter* eventWaiters = nullptr;            // Pending event awaits
+    TouchEventCallback touchEventCallback = nullptr; // Forwarded touch event callback
+
+    /**
+     * Resumes all coroutines waiting for a frame.
+     *
+     * @param touches Active touch points
+     * @param count Number of active touch points
+     */
+    void dispatchFrame(const TouchPoint* touches, uint8_t count);
+
+    /**
+     * Resumes the coroutines waiting for an event of this type.
+     *
+     * @param type Event type
+     * @param point Touch point the event applies to
+     */
+    void dispatchEvent(TouchEventType type, const TouchPoint& point);
+};
+
+#endif
\ No newline at end of file
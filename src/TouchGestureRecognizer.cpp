@@ -0,0 +1,380 @@
+#include "TouchGestureRecognizer.h"
+
+#include <math.h>
+
+bool TouchGestureRecognizer::addTemplate(uint8_t gestureId, const uint16_t* xs, const uint16_t* ys, const uint8_t* strokeIds, uint16_t count) {
+    if (templateCount >= MAX_TEMPLATES) {
+        return false;
+    }
+
+    Template& gestureTemplate = templates[templateCount];
+
+    if (!normalize(xs, ys, strokeIds, count, gestureTemplate.xs, gestureTemplate.ys)) {
+        return false;
+    }
+
+    gestureTemplate.gestureId = gestureId;
+    templateCount++;
+
+    return true;
+}
+
+void TouchGestureRecognizer::clearTemplates() {
+    templateCount = 0;
+}
+
+void TouchGestureRecognizer::addPoint(uint16_t x, uint16_t y, uint8_t strokeId) {
+    if (captureCount >= MAX_CAPTURE_POINTS) {
+        compactCapture();
+    }
+
+    // Compaction frees nothing when every stroke is down to its end points (many taps), make room by forgetting the
+    // oldest stroke instead
+    if (captureCount >= MAX_CAPTURE_POINTS) {
+        removeStroke(captureStrokes[0]);
+    }
+
+    captureXs[captureCount] = x;
+    captureYs[captureCount] = y;
+    captureStrokes[captureCount] = strokeId;
+    captureCount++;
+}
+
+void TouchGestureRecognizer::addTouches(const TouchPoint* touches, uint8_t count) {
+    uint8_t frameIds[MAX_TOUCHES];
+    uint8_t frameStrokes[MAX_TOUCHES];
+    uint8_t frameCount = 0;
+
+    for (uint8_t touchIndex = 0; touchIndex < count && frameCount < MAX_TOUCHES; touchIndex++) {
+        const TouchPoint& touch = touches[touchIndex];
+
+        if (!touch.active) {
+            continue;
+        }
+
+        // Continue the stroke of a contact that was down in the previous frame, start a new one otherwise
+        bool isContinued = false;
+        uint8_t strokeId = 0;
+
+        for (uint8_t activeIndex = 0; activeIndex < activeCount; activeIndex++) {
+            if (activeIds[activeIndex] == touch.id) {
+                strokeId = activeStrokes[activeIndex];
+                isContinued = true;
+                break;
+            }
+        }
+
+        if (!isContinued) {
+            // Stroke ids wrap around, skip ids still used by captured or continuing strokes so strokes never merge
+            while (isStrokeInUse(nextStrokeId, frameStrokes, frameCount)) {
+                nextStrokeId++;
+            }
+
+            strokeId = nextStrokeId++;
+        }
+
+        frameIds[frameCount] = touch.id;
+        frameStrokes[frameCount] = strokeId;
+        frameCount++;
+
+        addPoint(touch.x, touch.y, strokeId);
+    }
+
+    activeCount = frameCount;
+
+    for (uint8_t index = 0; index < frameCount; index++) {
+        activeIds[index] = frameIds[index];
+        activeStrokes[index] = frameStrokes[index];
+    }
+}
+
+void TouchGestureRecognizer::clearStrokes() {
+    captureCount = 0;
+    activeCount = 0;
+    nextStrokeId = 0;
+}
+
+uint8_t TouchGestureRecognizer::getPointCount() const {
+    return captureCount;
+}
+
+bool TouchGestureRecognizer::recognize(TouchGestureMatch& result) const {
+    float xs[NUM_POINTS];
+    float ys[NUM_POINTS];
+
+    if (templateCount == 0 || !normalize(captureXs, captureYs, captureStrokes, captureCount, xs, ys)) {
+        return false;
+    }
+
+    // Match in both directions from every step-th starting point, abandoning as soon as the best distance is exceeded
+    uint8_t step = static_cast<uint8_t>(sqrtf(NUM_POINTS));
+    float bestDistance = INFINITY;
+    uint8_t bestTemplate = 0;
+
+    for (uint8_t templateIndex = 0; templateIndex < templateCount; templateIndex++) {
+        const Template& gestureTemplate = templates[templateIndex];
+
+        for (uint8_t start = 0; start < NUM_POINTS; start += step) {
+            float forward = cloudDistance(xs, ys, gestureTemplate.xs, gestureTemplate.ys, start, bestDistance);
+            float backward = cloudDistance(gestureTemplate.xs, gestureTemplate.ys, xs, ys, start, bestDistance);
+            float distance = forward < backward ? forward : backward;
+
+            if (distance < bestDistance) {
+                bestDistance = distance;
+                bestTemplate = templateIndex;
+            }
+        }
+    }
+
+    result.gestureId = templates[bestTemplate].gestureId;
+    result.distance = bestDistance;
+    result.score = bestDistance > 1.0f ? 1.0f / bestDistance : 1.0f;
+
+    return true;
+}
+
+void TouchGestureRecognizer::compactCapture() {
+    uint8_t keptCount = 0;
+
+    for (uint8_t index = 0; index < captureCount; index++) {
+        // Rank of the point within its stroke and whether a later point continues the stroke
+        uint8_t rank = 0;
+        bool isLast = true;
+
+        for (uint8_t other = 0; other < captureCount; other++) {
+            if (captureStrokes[other] != captureStrokes[index]) {
+                continue;
+            }
+
+            if (other < index) {
+                rank++;
+            } else if (other > index) {
+                isLast = false;
+            }
+        }
+
+        if (rank % 2 == 0 || isLast) {
+            captureXs[keptCount] = captureXs[index];
+            captureYs[keptCount] = captureYs[index];
+            captureStrokes[keptCount] = captureStrokes[index];
+            keptCount++;
+        }
+    }
+
+    captureCount = keptCount;
+}
+
+void TouchGestureRecognizer::removeStroke(uint8_t strokeId) {
+    uint8_t keptCount = 0;
+
+    for (uint8_t index = 0; index < captureCount; index++) {
+        if (captureStrokes[index] != strokeId) {
+            captureXs[keptCount] = captureXs[index];
+            captureYs[keptCount] = captureYs[index];
+            captureStrokes[keptCount] = captureStrokes[index];
+            keptCount++;
+        }
+    }
+
+    captureCount = keptCount;
+}
+
+bool TouchGestureRecognizer::isStrokeInUse(uint8_t strokeId, const uint8_t* frameStrokes, uint8_t frameCount) const {
+    for (uint8_t index = 0; index < captureCount; index++) {
+        if (captureStrokes[index] == strokeId) {
+            return true;
+        }
+    }
+
+    for (uint8_t index = 0; index < activeCount; index++) {
+        if (activeStrokes[index] == strokeId) {
+            return true;
+        }
+    }
+
+    for (uint8_t index = 0; index < frameCount; index++) {
+        if (frameStrokes[index] == strokeId) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TouchGestureRecognizer::isStrokeStart(const uint8_t* strokeIds, uint16_t index) {
+    if (strokeIds == nullptr) {
+        return index == 0;
+    }
+
+    for (uint16_t other = 0; other < index; other++) {
+        if (strokeIds[other] == strokeIds[index]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool TouchGestureRecognizer::normalize(const uint16_t* xs, const uint16_t* ys, const uint8_t* strokeIds, uint16_t count, float* outXs, float* outYs) {
+    // Total path length, not connecting separate strokes
+    float pathLength = 0.0f;
+
+    for (uint16_t first = 0; first < count; first++) {
+        if (!isStrokeStart(strokeIds, first)) {
+            continue;
+        }
+
+        uint16_t previous = first;
+
+        for (uint16_t index = first + 1; index < count; index++) {
+            if (strokeIds != nullptr && strokeIds[index] != strokeIds[first]) {
+                continue;
+            }
+
+            float dx = static_cast<float>(xs[index]) - xs[previous];
+            float dy = static_cast<float>(ys[index]) - ys[previous];
+            pathLength += sqrtf(dx * dx + dy * dy);
+            previous = index;
+        }
+    }
+
+    if (pathLength <= 0.0f) {
+        return false;
+    }
+
+    // Resample to points equally spaced along the strokes
+    float interval = pathLength / (NUM_POINTS - 1);
+    float accumulated = 0.0f;
+    uint8_t outCount = 0;
+    float lastX = 0.0f;
+    float lastY = 0.0f;
+
+    for (uint16_t first = 0; first < count; first++) {
+        if (!isStrokeStart(strokeIds, first)) {
+            continue;
+        }
+
+        float previousX = xs[first];
+        float previousY = ys[first];
+
+        if (outCount == 0) {
+            outXs[outCount] = previousX;
+            outYs[outCount] = previousY;
+            outCount++;
+        }
+
+        for (uint16_t index = first + 1; index < count; index++) {
+            if (strokeIds != nullptr && strokeIds[index] != strokeIds[first]) {
+                continue;
+            }
+
+            float currentX = xs[index];
+            float currentY = ys[index];
+            float segment = sqrtf((currentX - previousX) * (currentX - previousX) + (currentY - previousY) * (currentY - previousY));
+
+            while (accumulated + segment >= interval && outCount < NUM_POINTS) {
+                float t = (interval - accumulated) / segment;
+                previousX += t * (currentX - previousX);
+                previousY += t * (currentY - previousY);
+                outXs[outCount] = previousX;
+                outYs[outCount] = previousY;
+                outCount++;
+                segment -= interval - accumulated;
+                accumulated = 0.0f;
+            }
+
+            accumulated += segment;
+            previousX = currentX;
+            previousY = currentY;
+            lastX = currentX;
+            lastY = currentY;
+        }
+    }
+
+    // Rounding can leave the last point out
+    while (outCount < NUM_POINTS) {
+        outXs[outCount] = lastX;
+        outYs[outCount] = lastY;
+        outCount++;
+    }
+
+    // Scale uniformly to a unit box and move the centroid to the origin
+    float minX = outXs[0];
+    float maxX = outXs[0];
+    float minY = outYs[0];
+    float maxY = outYs[0];
+
+    for (uint8_t index = 1; index < NUM_POINTS; index++) {
+        minX = outXs[index] < minX ? outXs[index] : minX;
+        maxX = outXs[index] > maxX ? outXs[index] : maxX;
+        minY = outYs[index] < minY ? outYs[index] : minY;
+        maxY = outYs[index] > maxY ? outYs[index] : maxY;
+    }
+
+    float size = (maxX - minX) > (maxY - minY) ? (maxX - minX) : (maxY - minY);
+
+    if (size <= 0.0f) {
+        return false;
+    }
+
+    float centroidX = 0.0f;
+    float centroidY = 0.0f;
+
+    for (uint8_t index = 0; index < NUM_POINTS; index++) {
+        outXs[index] = (outXs[index] - minX) / size;
+        outYs[index] = (outYs[index] - minY) / size;
+        centroidX += outXs[index];
+        centroidY += outYs[index];
+    }
+
+    centroidX /= NUM_POINTS;
+    centroidY /= NUM_POINTS;
+
+    for (uint8_t index = 0; index < NUM_POINTS; index++) {
+        outXs[index] -= centroidX;
+        outYs[index] -= centroidY;
+    }
+
+    return true;
+}
+
+float TouchGestureRecognizer::cloudDistance(const float* fromXs, const float* fromYs, const float* toXs, const float* toYs, uint8_t start, float limit) {
+    bool isMatched[NUM_POINTS] = {};
+    float sum = 0.0f;
+    uint8_t index = start;
+
+    for (uint8_t matchedCount = 0; matchedCount < NUM_POINTS; matchedCount++) {
+        // Match the point to its nearest unmatched point of the other cloud
+        float minDistance = INFINITY;
+        uint8_t nearest = 0;
+
+        for (uint8_t other = 0; other < NUM_POINTS; other++) {
+            if (isMatched[other]) {
+                continue;
+            }
+
+            float dx = fromXs[index] - toXs[other];
+            float dy = fromYs[index] - toYs[other];
+            float distance = sqrtf(dx * dx + dy * dy);
+
+            if (distance < minDistance) {
+                minDistance = distance;
+                nearest = other;
+            }
+        }
+
+        isMatched[nearest] = true;
+
+        // Earlier matches are more reliable and weigh more
+        float weight = 1.0f - static_cast<float>(matchedCount) / NUM_POINTS;
+        sum += weight * minDistance;
+
+        if (sum >= limit) {
+            return sum;
+        }
+
+        index = (index + 1) % NUM_POINTS;
+    }
+
+    return sum;
+}
\ No newline at end of file
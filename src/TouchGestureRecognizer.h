@@ -0,0 +1,186 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <Arduino.h>
+
+/**
+ * Result of a gesture recognition.
+ */
+struct TouchGestureMatch {
+    uint8_t gestureId; // Id of the best matching template
+    float score;       // Match score from 0 (no similarity) to 1 (identical point clouds)
+    float distance;    // Point cloud distance to the template (lower is better)
+};
+
+/**
+ * Recognizes drawn symbols such as circles, check marks or letters.
+ *
+ * Implements the $P point-cloud recognizer, which handles unistroke and multistroke gestures alike and does not
+ * depend on stroke order or direction. Templates are resampled to NUM_POINTS points, scaled and centered when they
+ * are registered, so matching a gesture costs a fixed amount of work per template. A greedy cloud distance with early
+ * abandoning against the best match so far keeps that cost low on a microcontroller.
+ *
+ * Stroke points are captured into a fixed-size buffer. When it fills up, every other point of each stroke is dropped
+ * (keeping the stroke end points), so long strokes keep their shape at a lower point density instead of being cut
+ * off. Since point clouds are resampled by path length, the uneven density does not affect matching. If the buffer is
+ * full of strokes that are already down to their end points (many taps), the oldest stroke is dropped instead.
+ * The recognizer only depends on the Arduino integer types, test/test_gesture_recognizer replays recorded strokes
+ * against it on the host.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchGestureRecognizer gestures;
+ * gestures.addTemplate(GESTURE_CHECK, checkXs, checkYs, nullptr, CHECK_POINT_COUNT);
+ *
+ * touch.addTouchListener([](const TouchPoint* touches, uint8_t count) {
+ *     gestures.addTouches(touches, count);
+ * });
+ *
+ * // When the user is done drawing
+ * TouchGestureMatch match;
+ * if (gestures.recognize(match) && match.score > 0.5f) {
+ *     runShortcut(match.gestureId);
+ * }
+ * gestures.clearStrokes();
+ * @endcode
+ */
+class TouchGestureRecognizer {
+  public:
+    static constexpr uint8_t NUM_POINTS = 32;          // Points per resampled point cloud
+    static constexpr uint8_t MAX_TEMPLATES = 8;        // Maximum number of registered templates
+    static constexpr uint8_t MAX_CAPTURE_POINTS = 128; // Capacity of the stroke capture buffer
+    static constexpr uint8_t MAX_TOUCHES = 6;          // Maximum simultaneous touch points supported by the protocol
+
+    /**
+     * Registers a gesture template.
+     *
+     * Points belonging to different strokes are not connected when resampling. Coordinates can use any units, only
+     * the shape matters.
+     *
+     * @param gestureId Id reported when the template matches (several templates may share an id)
+     * @param xs X coordinates of the template points
+     * @param ys Y coordinates of the template points
+     * @param strokeIds Stroke of each point, or nullptr for a single stroke
+     * @param count Number of points
+     * @return True if registered, false if MAX_TEMPLATES templates are registered or the points have no extent
+     */
+    bool addTemplate(uint8_t gestureId, const uint16_t* xs, const uint16_t* ys, const uint8_t* strokeIds, uint16_t count);
+
+    /** Removes all templates. */
+    void clearTemplates();
+
+    /**
+     * Adds a point to the captured strokes.
+     *
+     * @param x X coordinate
+     * @param y Y coordinate
+     * @param strokeId Stroke the point belongs to
+     */
+    void addPoint(uint16_t x, uint16_t y, uint8_t strokeId);
+
+    /**
+     * Adds the active contacts of a touch frame to the captured strokes.
+     *
+     * Each contact is its own stroke, and a contact id that touches down again starts a new stroke.
+     *
+     * @param touches Touch points in the frame
+     * @param count Number of touch points
+     */
+    void addTouches(const TouchPoint* touches, uint8_t count);
+
+    /** Discards the captured strokes. */
+    void clearStrokes();
+
+    /**
+     * Gets the number of captured points.
+     *
+     * @return Points in the capture buffer
+     */
+    uint8_t getPointCount() const;
+
+    /**
+     * Matches the captured strokes against the templates.
+     *
+     * @param result Receives the best match
+     * @return True if a template was matched, false if there are no templates or the strokes have no extent
+     */
+    bool recognize(TouchGestureMatch& result) const;
+
+  private:
+    /**
+     * Normalized template point cloud.
+     */
+    struct Template {
+        uint8_t gestureId;    // Id reported when the template matches
+        float xs[NUM_POINTS]; // Resampled, scaled and centered x coordinates
+        float ys[NUM_POINTS]; // Resampled, scaled and centered y coordinates
+    };
+
+    Template templates[MAX_TEMPLATES] = {};          // Registered templates
+    uint8_t templateCount = 0;                       // Number of registered templates
+    uint16_t captureXs[MAX_CAPTURE_POINTS] = {};     // Captured point x coordinates
+    uint16_t captureYs[MAX_CAPTURE_POINTS] = {};     // Captured point y coordinates
+    uint8_t captureStrokes[MAX_CAPTURE_POINTS] = {}; // Stroke of each captured point
+    uint8_t captureCount = 0;                        // Number of captured points
+    uint8_t activeIds[MAX_TOUCHES] = {};             // Contact ids in the previous addTouches() frame
+    uint8_t activeStrokes[MAX_TOUCHES] = {};         // Stroke of each contact in activeIds
+    uint8_t activeCount = 0;                         // Number of entries in activeIds
+    uint8_t nextStrokeId = 0;                        // Stroke id for the next contact that touches down
+
+    /** Drops every other point of each captured stroke, keeping the stroke end points. */
+    void compactCapture();
+
+    /**
+     * Removes all captured points of a stroke.
+     *
+     * @param strokeId Stroke to remove
+     */
+    void removeStroke(uint8_t strokeId);
+
+    /**
+     * Checks whether a stroke id is taken by a captured point or a contact that is down.
+     *
+     * @param strokeId Stroke id to check
+     * @param frameStrokes Strokes already assigned in the current addTouches() frame
+     * @param frameCount Number of entries in frameStrokes
+     * @return True if the id is in use
+     */
+    bool isStrokeInUse(uint8_t strokeId, const uint8_t* frameStrokes, uint8_t frameCount) const;
+
+    /**
+     * Checks whether a point is the first point of its stroke.
+     *
+     * @param strokeIds Stroke of each point, or nullptr for a single stroke
+     * @param index Point index
+     * @return True if no earlier point belongs to the same stroke
+     */
+    static bool isStrokeStart(const uint8_t* strokeIds, uint16_t index);
+
+    /**
+     * Resamples, scales and centers a point cloud.
+     *
+     * @param xs X coordinates
+     * @param ys Y coordinates
+     * @param strokeIds Stroke of each point, or nullptr for a single stroke
+     * @param count Number of points
+     * @param outXs Array receiving NUM_POINTS normalized x coordinates
+     * @param outYs Array receiving NUM_POINTS normalized y coordinates
+     * @return True on success, false if the points have no extent
+     */
+    static bool normalize(const uint16_t* xs, const uint16_t* ys, const uint8_t* strokeIds, uint16_t count, float* outXs, float* outYs);
+
+    /**
+     * Computes the greedy $P cloud distance starting at a point.
+     *
+     * @param fromXs X coordinates of the cloud whose points are matched in order
+     * @param fromYs Y coordinates of the cloud whose points are matched in order
+     * @param toXs X coordinates of the cloud matched against
+     * @param toYs Y coordinates of the cloud matched against
+     * @param start Index of the first point to match
+     * @param limit Distance at which matching is abandoned
+     * @return Weighted cloud distance, at least limit if abandoned
+     */
+    static float cloudDistance(const float* fromXs, const float* fromYs, const float* toXs, const float* toYs, uint8_t start, float limit);
+};
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "TouchHeatmap.h"
+
+void TouchHeatmap::addTouches(const TouchPoint* touches, uint8_t count) {
+    for (uint8_t touchIndex = 0; touchIndex < count; touchIndex++) {
+        const TouchPoint& touch = touches[touchIndex];
+
+        if (!touch.active || touch.frameWidth == 0 || touch.frameHeight == 0) {
+            continue;
+        }
+
+        uint32_t column = static_cast<uint32_t>(touch.x) * COLUMNS / touch.frameWidth;
+        uint32_t row = static_cast<uint32_t>(touch.y) * ROWS / touch.frameHeight;
+        uint16_t& cell = cells[row < ROWS ? row : ROWS - 1][column < COLUMNS ? column : COLUMNS - 1];
+
+        if (cell < UINT16_MAX) {
+            cell++;
+        }
+    }
+
+    if (decayInterval == 0 || ++framesSinceDecay < decayInterval) {
+        return;
+    }
+
+    decay();
+}
+
+void TouchHeatmap::decay() {
+    framesSinceDecay = 0;
+
+    // Round the decrement up so small counts still reach zero instead of lingering forever
+    for (uint8_t row = 0; row < ROWS; row++) {
+        for (uint8_t column = 0; column < COLUMNS; column++) {
+            uint16_t& cell = cells[row][column];
+            cell -= static_cast<uint16_t>((static_cast<uint32_t>(cell) + (1u << decayShift) - 1) >> decayShift);
+        }
+    }
+}
+
+void TouchHeatmap::setDecay(uint32_t intervalFrames, uint8_t shift) {
+    decayInterval = intervalFrames;
+    decayShift = shift < 1 ? 1 : (shift > 15 ? 15 : shift);
+    framesSinceDecay = 0;
+}
+
+void TouchHeatmap::clear() {
+    for (uint8_t row = 0; row < ROWS; row++) {
+        for (uint8_t column = 0; column < COLUMNS; column++) {
+            cells[row][column] = 0;
+        }
+    }
+
+    framesSinceDecay = 0;
+}
+
+uint16_t TouchHeatmap::getCell(uint8_t column, uint8_t row) const {
+    if (column >= COLUMNS || row >= ROWS) {
+        return 0;
+    }
+
+    return cells[row][column];
+}
+
+uint16_t TouchHeatmap::getMaxCount() const {
+    uint16_t maxCount = 0;
+
+    for (uint8_t row = 0; row < ROWS; row++) {
+        for (uint8_t column = 0; column < COLUMNS; column++) {
+            if (cells[row][column] > maxCount) {
+                maxCount = cells[row][column];
+            }
+        }
+    }
+
+    return maxCount;
+}
+
+size_t TouchHeatmap::exportCompact(uint8_t* buffer, size_t capacity) const {
+    if (capacity < 4) {
+        return 0;
+    }
+
+    uint16_t maxCount = getMaxCount();
+    buffer[0] = COLUMNS;
+    buffer[1] = ROWS;
+    buffer[2] = maxCount & 0xFF;
+    buffer[3] = maxCount >> 8;
+    size_t length = 4;
+
+    uint8_t runLevel = toLevel(cells[0][0], maxCount);
+    uint8_t runLength = 0;
+
+    for (uint16_t cellIndex = 0; cellIndex < ROWS * COLUMNS; cellIndex++) {
+        uint8_t level = toLevel(cells[cellIndex / COLUMNS][cellIndex % COLUMNS], maxCount);
+
+        if (level == runLevel && runLength < UINT8_MAX) {
+            runLength++;
+            continue;
+        }
+
+        if (length + 2 > capacity) {
+            return 0;
+        }
+
+        buffer[length++] = runLength;
+        buffer[length++] = runLevel;
+        runLevel = level;
+        runLength = 1;
+    }
+
+    if (length + 2 > capacity) {
+        return 0;
+    }
+
+    buffer[length++] = runLength;
+    buffer[length++] = runLevel;
+
+    return length;
+}
+
+uint8_t TouchHeatmap::toLevel(uint16_t count, uint16_t maxCount) {
+    if (count == 0) {
+        return 0;
+    }
+
+    return (static_cast<uint32_t>(count) * UINT8_MAX + maxCount - 1) / maxCount;
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <Arduino.h>
+
+/**
+ * Accumulates where the sensor is touched for usage analytics.
+ *
+ * Keeps a fixed COLUMNS x ROWS grid of saturating 16-bit counters over the sensor frame. Every active contact adds one
+ * count to its cell per frame, so cells measure contact time in frames. An optional exponential decay periodically
+ * removes a fraction of every count, turning the grid into a recent-activity map instead of an all-time total.
+ *
+ * The grid can be exported as a compact run-length encoded snapshot, so analytics can be collected on-device and
+ * uploaded occasionally instead of streaming raw frames. The grid takes COLUMNS * ROWS * 2 bytes of RAM (5 KB), so
+ * only instantiate it on boards that have the memory.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchHeatmap heatmap;
+ *
+ * touch.addTouchListener([](const TouchPoint* touches, uint8_t count) {
+ *     heatmap.addTouches(touches, count);
+ * });
+ *
+ * // Halve all counts every hour of wall-clock time, including idle time
+ * if (millis() - lastDecayMs >= 60UL * 60 * 1000) {
+ *     lastDecayMs = millis();
+ *     heatmap.decay();
+ * }
+ *
+ * uint8_t snapshot[1024];
+ * size_t length = heatmap.exportCompact(snapshot, sizeof(snapshot));
+ * @endcode
+ */
+class TouchHeatmap {
+  public:
+    static constexpr uint8_t COLUMNS = 64;            // Grid columns across the frame width
+    static constexpr uint8_t ROWS = 40;               // Grid rows across the frame height
+    static constexpr uint8_t DEFAULT_DECAY_SHIFT = 1; // Default decay, removes count >> 1 (half) per decay step
+
+    /**
+     * Adds the active contacts of a touch frame.
+     *
+     * @param touches Touch points in the frame
+     * @param count Number of touch points
+     */
+    void addTouches(const TouchPoint* touches, uint8_t count);
+
+    /**
+     * Configures exponential decay.
+     *
+     * Every intervalFrames calls to addTouches(), each count is reduced by count >> shift (rounded up). The sensor only
+     * sends frames while it is touched, so this decays per frame of activity and idle time does not decay the map. Call
+     * decay() from a timer instead to decay by elapsed time.
+     *
+     * @param intervalFrames Frames between decay steps (0 disables decay)
+     * @param shift Decay strength, 1 halves the counts, 2 removes a quarter, and so on
+     */
+    void setDecay(uint32_t intervalFrames, uint8_t shift = DEFAULT_DECAY_SHIFT);
+
+    /**
+     * Applies one decay step now, reducing each count by count >> shift (rounded up).
+     *
+     * Uses the shift set by setDecay(), which may be called with intervalFrames 0 to only decay through this method.
+     */
+    void decay();
+
+    /** Resets all counts to zero. */
+    void clear();
+
+    /**
+     * Gets the count of a cell.
+     *
+     * @param column Cell column (0 to COLUMNS - 1)
+     * @param row Cell row (0 to ROWS - 1)
+     * @return Cell count, 0 for cells outside the grid
+     */
+    uint16_t getCell(uint8_t column, uint8_t row) const;
+
+    /**
+     * Gets the largest cell count.
+     *
+     * @return Maximum count over all cells
+     */
+    uint16_t getMaxCount() const;
+
+    /**
+     * Exports the grid as a compact snapshot.
+     *
+     * Layout: columns (1 byte), rows (1 byte), maximum count (2 bytes, little-endian), followed by (run length, level)
+     * byte pairs covering the cells in row-major order. Levels are counts scaled to 0-255 relative to the maximum
+     * count (rounded up, so touched cells never export as 0) and runs are 1-255 cells long.
+     *
+     * @param buffer Buffer receiving the snapshot
+     * @param capacity Size of buffer in bytes
+     * @return Number of bytes written, 0 if the buffer is too small
+     */
+    size_t exportCompact(uint8_t* buffer, size_t capacity) const;
+
+  private:
+    uint16_t cells[ROWS][COLUMNS] = {};       // Saturating contact counts per cell
+    uint32_t decayInterval = 0;               // Frames between decay steps, 0 when disabled
+    uint8_t decayShift = DEFAULT_DECAY_SHIFT; // Decay strength
+    uint32_t framesSinceDecay = 0;            // Frames added since the last decay step
+
+    /**
+     * Scales a count to an export level.
+     *
+     * @param count Cell count
+     * @param maxCount Maximum cell count
+     * @return Level from 0 to 255
+     */
+    static uint8_t toLevel(uint16_t count, uint16_t maxCount);
+};
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "TouchNoiseProfiler.h"
+
+#include <cstring>
+#include <math.h>
+
+void TouchNoiseProfiler::addTouches(const TouchPoint* touches, uint8_t count) {
+    Session nextSessions[MAX_TOUCHES] = {};
+    uint8_t nextCount = 0;
+    bool isContinued[MAX_TOUCHES] = {};
+
+    for (uint8_t touchIndex = 0; touchIndex < count && nextCount < MAX_TOUCHES; touchIndex++) {
+        const TouchPoint& touch = touches[touchIndex];
+
+        if (!touch.active || touch.frameWidth == 0 || touch.frameHeight == 0) {
+            continue;
+        }
+
+        uint32_t column = static_cast<uint32_t>(touch.x) * COLUMNS / touch.frameWidth;
+        uint32_t row = static_cast<uint32_t>(touch.y) * ROWS / touch.frameHeight;
+        Session& session = nextSessions[nextCount++];
+        session = Session {};
+        session.id = touch.id;
+        session.column = column < COLUMNS ? column : COLUMNS - 1;
+        session.row = row < ROWS ? row : ROWS - 1;
+
+        // Continue the estimate of a contact resting in the same cell, a contact that changed cells starts over
+        for (uint8_t sessionIndex = 0; sessionIndex < sessionCount; sessionIndex++) {
+            const Session& previous = sessions[sessionIndex];
+
+            if (previous.id == touch.id && previous.column == session.column && previous.row == session.row) {
+                session = previous;
+                isContinued[sessionIndex] = true;
+
+                break;
+            }
+        }
+
+        // Welford's online update
+        session.samples++;
+        float deltaX = touch.x - session.meanX;
+        float deltaY = touch.y - session.meanY;
+        float deltaPressure = touch.pressure - session.meanPressure;
+        session.meanX += deltaX / session.samples;
+        session.meanY += deltaY / session.samples;
+        session.meanPressure += deltaPressure / session.samples;
+        session.sumSquaresX += deltaX * (touch.x - session.meanX);
+        session.sumSquaresY += deltaY * (touch.y - session.meanY);
+        session.sumSquaresPressure += deltaPressure * (touch.pressure - session.meanPressure);
+    }
+
+    // Lifted contacts and contacts that changed cells are done resting
+    for (uint8_t sessionIndex = 0; sessionIndex < sessionCount; sessionIndex++) {
+        if (!isContinued[sessionIndex]) {
+            pool(sessions[sessionIndex]);
+        }
+    }
+
+    memcpy(sessions, nextSessions, sizeof(sessions));
+    sessionCount = nextCount;
+}
+
+void TouchNoiseProfiler::flush() {
+    for (uint8_t sessionIndex = 0; sessionIndex < sessionCount; sessionIndex++) {
+        Session& session = sessions[sessionIndex];
+        pool(session);
+
+        // Keep tracking the contact with a fresh estimate
+        session = Session {session.id, session.column, session.row, 0, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    }
+}
+
+void TouchNoiseProfiler::clear() {
+    memset(cells, 0, sizeof(cells));
+    sessionCount = 0;
+}
+
+bool TouchNoiseProfiler::getCellNoise(uint8_t column, uint8_t row, TouchNoise& noise) const {
+    if (column >= COLUMNS || row >= ROWS || cells[row][column].degrees == 0) {
+        return false;
+    }
+
+    const Cell& cell = cells[row][column];
+    noise.samples = cell.samples;
+    noise.stdDevX = sqrtf(cell.sumSquaresX / cell.degrees);
+    noise.stdDevY = sqrtf(cell.sumSquaresY / cell.degrees);
+    noise.stdDevPressure = sqrtf(cell.sumSquaresPressure / cell.degrees);
+
+    return true;
+}
+
+size_t TouchNoiseProfiler::exportCompact(uint8_t* buffer, size_t capacity) const {
+    size_t length = 2 + static_cast<size_t>(ROWS) * COLUMNS * 8;
+
+    if (capacity < length) {
+        return 0;
+    }
+
+    buffer[0] = COLUMNS;
+    buffer[1] = ROWS;
+    uint8_t* record = buffer + 2;
+
+    for (uint8_t row = 0; row < ROWS; row++) {
+        for (uint8_t column = 0; column < COLUMNS; column++) {
+            TouchNoise noise = {};
+            getCellNoise(column, row, noise);
+
+            uint32_t values[4] = {
+                noise.samples,
+                static_cast<uint32_t>(noise.stdDevX * 16.0f + 0.5f),
+                static_cast<uint32_t>(noise.stdDevY * 16.0f + 0.5f),
+                static_cast<uint32_t>(noise.stdDevPressure * 16.0f + 0.5f),
+            };
+
+            for (uint8_t valueIndex = 0; valueIndex < 4; valueIndex++) {
+                uint16_t value = values[valueIndex] < UINT16_MAX ? values[valueIndex] : UINT16_MAX;
+                *record++ = value & 0xFF;
+                *record++ = value >> 8;
+            }
+        }
+    }
+
+    return length;
+}
+
+void TouchNoiseProfiler::pool(const Session& session) {
+    // A single sample carries no information about the spread
+    if (session.samples < 2) {
+        return;
+    }
+
+    Cell& cell = cells[session.row][session.column];
+    cell.samples += session.samples;
+    cell.degrees += session.samples - 1;
+    cell.sumSquaresX += session.sumSquaresX;
+    cell.sumSquaresY += session.sumSquaresY;
+    cell.sumSquaresPressure += session.sumSquaresPressure;
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <Arduino.h>
+
+/**
+ * Measured noise of one region of the sensor.
+ */
+struct TouchNoise {
+    uint32_t samples;     // Number of frames the statistics are based on
+    float stdDevX;        // Standard deviation of x in sensor units
+    float stdDevY;        // Standard deviation of y in sensor units
+    float stdDevPressure; // Standard deviation of the pressure
+};
+
+/**
+ * Characterizes position and pressure noise across the sensor.
+ *
+ * Meant for a calibration session where a test object rests on the glass at different locations. The positions and
+ * pressure of each resting contact are accumulated with Welford's online algorithm while it stays in one grid cell.
+ * When the contact lifts or moves to another cell, its statistics are pooled into the cell, so the variance measures
+ * the jitter around each rest position rather than the distance between separate placements.
+ *
+ * Memory use is fixed: COLUMNS x ROWS cells of 20 bytes (3.2 KB) plus one running estimate per contact. The resulting
+ * map can drive per-region filter strength, for example a larger dead-zone in noisy regions.
+ *
+ * The profiler sees the touches after DisplaxTouch has filtered them, so the contact filters must be off during the
+ * session: a dead-zone freezes resting contacts and reports zero variance, stuck contact suppression removes the
+ * resting test object, and presence hysteresis repeats held positions. Keep setDeadZone(0), setStuckContactTimeout(0)
+ * and the default setPresenceHysteresis(1, 1) (all defaults) while characterizing, and apply the tuned filters
+ * afterwards.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchNoiseProfiler profiler;
+ * touch.setDeadZone(0);
+ * touch.setStuckContactTimeout(0);
+ * touch.setPresenceHysteresis(1, 1);
+ *
+ * touch.addTouchListener([](const TouchPoint* touches, uint8_t count) {
+ *     profiler.addTouches(touches, count);
+ * });
+ *
+ * // After the session
+ * TouchNoise noise;
+ * profiler.getCellNoise(column, row, noise);
+ * @endcode
+ */
+class TouchNoiseProfiler {
+  public:
+    static constexpr uint8_t COLUMNS = 16;    // Grid columns across the frame width
+    static constexpr uint8_t ROWS = 10;       // Grid rows across the frame height
+    static constexpr uint8_t MAX_TOUCHES = 6; // Maximum simultaneous touch points supported by the protocol
+
+    /**
+     * Adds the contacts of a touch frame.
+     *
+     * @param touches Touch points in the frame
+     * @param count Number of touch points (0 when all contacts have been released)
+     */
+    void addTouches(const TouchPoint* touches, uint8_t count);
+
+    /**
+     * Pools the running estimates of all contacts into their cells.
+     *
+     * Call before reading the results while the test object is still resting on the glass.
+     */
+    void flush();
+
+    /** Discards all statistics. */
+    void clear();
+
+    /**
+     * Gets the noise measured in a cell.
+     *
+     * @param column Cell column (0 to COLUMNS - 1)
+     * @param row Cell row (0 to ROWS - 1)
+     * @param noise Receives the noise statistics
+     * @return True if the cell has at least two samples from one rest position
+     */
+    bool getCellNoise(uint8_t column, uint8_t row, TouchNoise& noise) const;
+
+    /**
+     * Exports the noise map as a compact snapshot.
+     *
+     * Layout: columns (1 byte), rows (1 byte), followed by one record per cell in row-major order. Each record holds
+     * four little-endian 16-bit values: samples (saturating), then the x, y and pressure standard deviations in 1/16
+     * units (saturating). Cells without statistics export as zeros.
+     *
+     * @param buffer Buffer receiving the snapshot
+     * @param capacity Size of buffer in bytes
+     * @return Number of bytes written, 0 if the buffer is too small
+     */
+    size_t exportCompact(uint8_t* buffer, size_t capacity) const;
+
+  private:
+    /**
+     * Pooled statistics of one grid cell.
+     */
+    struct Cell {
+        uint32_t samples;         // Number of pooled samples
+        uint32_t degrees;         // Degrees of freedom (samples minus one per pooled rest position)
+        float sumSquaresX;        // Pooled sum of squared x deviations
+        float sumSquaresY;        // Pooled sum of squared y deviations
+        float sumSquaresPressure; // Pooled sum of squared pressure deviations
+    };
+
+    /**
+     * Running Welford estimate of one resting contact.
+     */
+    struct Session {
+        uint8_t id;               // Touch point identifier
+        uint8_t column;           // Cell column the contact rests in
+        uint8_t row;              // Cell row the contact rests in
+        uint32_t samples;         // Number of samples
+        float meanX;              // Running mean of x
+        float meanY;              // Running mean of y
+        float meanPressure;       // Running mean of the pressure
+        float sumSquaresX;        // Running sum of squared x deviations
+        float sumSquaresY;        // Running sum of squared y deviations
+        float sumSquaresPressure; // Running sum of squared pressure deviations
+    };
+
+    Cell cells[ROWS][COLUMNS] = {};     // Pooled statistics per cell
+    Session sessions[MAX_TOUCHES] = {}; // Running estimates of the current contacts
+    uint8_t sessionCount = 0;           // Number of running estimates
+
+    /**
+     * Pools a running estimate into its cell.
+     *
+     * @param session Running estimate of a contact
+     */
+    void pool(const Session& session);
+};
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Represents a single touch point from the Displax touch sensor.
+ *
+ * Contains position, size, pressure information and frame dimensions for coordinate normalization.
+ */
+struct TouchPoint {
+    uint8_t id;           // Unique touch point identifier (0-5)
+    uint16_t x;           // X coordinate in sensor units (0 to frameWidth)
+    uint16_t y;           // Y coordinate in sensor units (0 to frameHeight)
+    uint8_t width;        // Touch contact width
+    uint8_t height;       // Touch contact height
+    uint16_t pressure;    // Touch pressure value
+    uint16_t frameWidth;  // Sensor frame width for coordinate normalization
+    uint16_t frameHeight; // Sensor frame height for coordinate normalization
+    bool active;          // True if touch is currently active
+    bool moved;           // True if the position changed since the previous frame (always true for new contacts)
+};
+
+/**
+ * Snapshot of the active touch points of one sensor frame.
+ *
+ * Used where frames are handed over by value instead of through a listener callback.
+ */
+struct TouchFrame {
+    static constexpr uint8_t MAX_TOUCHES = 6; // Frame capacity, the maximum simultaneous touch points of the protocol
+
+    TouchPoint touches[MAX_TOUCHES]; // Active touch points
+    uint8_t count;                   // Number of active touch points (0 when all contacts have been released)
+    unsigned long timestampUs;       // Estimated host time the frame was sampled at in microseconds
+
+    /**
+     * Fills the frame from the touch points passed to a touch listener.
+     *
+     * @param points Touch points in the frame
+     * @param pointCount Number of touch points, clamped to MAX_TOUCHES
+     * @param frameTimestampUs Time the frame was sampled at in microseconds
+     */
+    void assign(const TouchPoint* points, uint8_t pointCount, unsigned long frameTimestampUs) {
+        count = pointCount < MAX_TOUCHES ? pointCount : MAX_TOUCHES;
+        timestampUs = frameTimestampUs;
+
+        for (uint8_t touchIndex = 0; touchIndex < count; touchIndex++) {
+            touches[touchIndex] = points[touchIndex];
+        }
+    }
+};
\ No newline at end of file
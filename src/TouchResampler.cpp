@@ -0,0 +1,131 @@
+#include "TouchResampler.h"
+
+void TouchResampler::addFrame(const TouchPoint* touches, uint8_t count, unsigned long timestampUs) {
+    if (count > MAX_TOUCHES) {
+        count = MAX_TOUCHES;
+    }
+
+    // Advance the ring buffer, overwriting the oldest frame once full
+    if (frameCount > 0) {
+        newestIndex = (newestIndex + 1) % HISTORY_SIZE;
+    }
+
+    if (frameCount < HISTORY_SIZE) {
+        frameCount++;
+    }
+
+    Frame& frame = history[newestIndex];
+    frame.timestampUs = timestampUs;
+    frame.count = count;
+
+    for (uint8_t touchIndex = 0; touchIndex < count; touchIndex++) {
+        frame.ids[touchIndex] = touches[touchIndex].id;
+        frame.xs[touchIndex] = touches[touchIndex].x;
+        frame.ys[touchIndex] = touches[touchIndex].y;
+        newestTouches[touchIndex] = touches[touchIndex];
+    }
+}
+
+void TouchResampler::clear() {
+    frameCount = 0;
+    newestIndex = 0;
+}
+
+uint8_t TouchResampler::getTouchesAt(unsigned long timeUs, TouchPoint* output, unsigned long maxExtrapolationUs) const {
+    if (frameCount == 0) {
+        return 0;
+    }
+
+    const Frame& newest = history[newestIndex];
+
+    for (uint8_t touchIndex = 0; touchIndex < newest.count; touchIndex++) {
+        TouchPoint& point = output[touchIndex];
+        point = newestTouches[touchIndex];
+
+        // Collect this contact's samples from newest to oldest
+        unsigned long sampleTimes[HISTORY_SIZE];
+        uint16_t sampleXs[HISTORY_SIZE];
+        uint16_t sampleYs[HISTORY_SIZE];
+        uint8_t sampleCount = 0;
+
+        for (uint8_t age = 0; age < frameCount; age++) {
+            const Frame& frame = history[(newestIndex + HISTORY_SIZE - age) % HISTORY_SIZE];
+            int contactIndex = findContact(frame, point.id);
+
+            if (contactIndex < 0) {
+                continue;
+            }
+
+            sampleTimes[sampleCount] = frame.timestampUs;
+            sampleXs[sampleCount] = frame.xs[contactIndex];
+            sampleYs[sampleCount] = frame.ys[contactIndex];
+            sampleCount++;
+        }
+
+        // Signed differences keep the comparisons correct across micros() wraparound
+        if (static_cast<long>(timeUs - sampleTimes[0]) >= 0) {
+            // At or after the newest sample: extrapolate along the last segment, limited in time
+            if (sampleCount < 2) {
+                continue;
+            }
+
+            unsigned long extrapolationUs = timeUs - sampleTimes[0];
+            unsigned long sampleTimeUs = sampleTimes[0] + (extrapolationUs < maxExtrapolationUs ? extrapolationUs : maxExtrapolationUs);
+
+            point.x = interpolate(sampleXs[1], sampleXs[0], sampleTimes[1], sampleTimes[0], sampleTimeUs, point.frameWidth);
+            point.y = interpolate(sampleYs[1], sampleYs[0], sampleTimes[1], sampleTimes[0], sampleTimeUs, point.frameHeight);
+
+            continue;
+        }
+
+        // Before the newest sample: interpolate between the samples bracketing the requested time
+        uint8_t olderIndex = 1;
+
+        while (olderIndex < sampleCount && static_cast<long>(timeUs - sampleTimes[olderIndex]) < 0) {
+            olderIndex++;
+        }
+
+        if (olderIndex < sampleCount) {
+            point.x = interpolate(sampleXs[olderIndex], sampleXs[olderIndex - 1], sampleTimes[olderIndex], sampleTimes[olderIndex - 1], timeUs, point.frameWidth);
+            point.y = interpolate(sampleYs[olderIndex], sampleYs[olderIndex - 1], sampleTimes[olderIndex], sampleTimes[olderIndex - 1], timeUs, point.frameHeight);
+        } else {
+            // Older than the history, hold the oldest known position
+            point.x = sampleXs[sampleCount - 1];
+            point.y = sampleYs[sampleCount - 1];
+        }
+    }
+
+    return newest.count;
+}
+
+int TouchResampler::findContact(const Frame& frame, uint8_t id) {
+    for (uint8_t contactIndex = 0; contactIndex < frame.count; contactIndex++) {
+        if (frame.ids[contactIndex] == id) {
+            return contactIndex;
+        }
+    }
+
+    return -1;
+}
+
+uint16_t TouchResampler::interpolate(uint16_t fromValue, uint16_t toValue, unsigned long fromTimeUs, unsigned long toTimeUs, unsigned long timeUs, uint16_t maxValue) {
+    long spanUs = static_cast<long>(toTimeUs - fromTimeUs);
+
+    if (spanUs <= 0) {
+        return toValue;
+    }
+
+    // 64-bit intermediate since coordinate delta times elapsed microseconds can exceed 32 bits
+    int64_t elapsedUs = static_cast<long>(timeUs - fromTimeUs);
+    int64_t value = fromValue + (static_cast<int64_t>(toValue) - fromValue) * elapsedUs / spanUs;
+
+    if (value < 0) {
+        return 0;
+    }
+
+    if (value > maxValue) {
+        return maxValue;
+    }
+
+    return static_cast<uint16_t>(value);
+}
\ No newline at end of file
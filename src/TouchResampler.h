@@ -0,0 +1,87 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <Arduino.h>
+
+/**
+ * Resamples touch frames to arbitrary timestamps.
+ *
+ * Keeps the last few timestamped touch frames and produces interpolated contact positions at a requested time, so a
+ * renderer running at a fixed refresh rate can sample touches exactly at vsync instead of seeing the beat frequency
+ * between the sensor and display rates.
+ *
+ * Requested times between two frames are linearly interpolated per contact id. Times after the newest frame are
+ * extrapolated from the last two samples of each contact, limited to a maximum extrapolation time. Sampling about
+ * one frame interval in the past avoids extrapolation entirely at the cost of that much latency.
+ */
+class TouchResampler {
+  public:
+    static constexpr uint8_t MAX_TOUCHES = 6;                           // Maximum simultaneous touch points supported by the protocol
+    static constexpr uint8_t HISTORY_SIZE = 4;                          // Number of frames kept for interpolation
+    static constexpr unsigned long DEFAULT_MAX_EXTRAPOLATION_US = 8000; // Default limit for extrapolating past the newest frame
+
+    /**
+     * Adds a touch frame to the history.
+     *
+     * @param touches Touch points in the frame
+     * @param count Number of touch points (0 when all contacts have been released)
+     * @param timestampUs Time the frame was sampled in microseconds
+     */
+    void addFrame(const TouchPoint* touches, uint8_t count, unsigned long timestampUs);
+
+    /** Forgets all frames. */
+    void clear();
+
+    /**
+     * Gets contact positions resampled at the given time.
+     *
+     * Returns the contacts that are down in the newest frame, with positions interpolated (or extrapolated) to the
+     * requested time. Size and pressure are taken from the newest frame.
+     *
+     * @param timeUs Time to sample at in microseconds (same time base as addFrame())
+     * @param output Array receiving the resampled touch points (at least MAX_TOUCHES entries)
+     * @param maxExtrapolationUs Maximum time to extrapolate past the newest frame in microseconds
+     * @return Number of touch points written to output
+     */
+    uint8_t getTouchesAt(unsigned long timeUs, TouchPoint* output, unsigned long maxExtrapolationUs = DEFAULT_MAX_EXTRAPOLATION_US) const;
+
+  private:
+    /**
+     * Timestamped touch frame.
+     */
+    struct Frame {
+        unsigned long timestampUs; // Time the frame was sampled
+        uint8_t count;             // Number of touch points in the frame
+        uint8_t ids[MAX_TOUCHES];  // Touch point ids
+        uint16_t xs[MAX_TOUCHES];  // Touch point x coordinates
+        uint16_t ys[MAX_TOUCHES];  // Touch point y coordinates
+    };
+
+    Frame history[HISTORY_SIZE] = {};           // Ring buffer of recent frames
+    uint8_t frameCount = 0;                     // Number of frames in history
+    uint8_t newestIndex = 0;                    // Index of the newest frame in history
+    TouchPoint newestTouches[MAX_TOUCHES] = {}; // Full touch points of the newest frame
+
+    /**
+     * Finds a contact in a frame.
+     *
+     * @param frame Frame to search
+     * @param id Touch point id
+     * @return Index of the contact in the frame, -1 if not present
+     */
+    static int findContact(const Frame& frame, uint8_t id);
+
+    /**
+     * Interpolates a coordinate between two samples.
+     *
+     * @param fromValue Coordinate at fromTimeUs
+     * @param toValue Coordinate at toTimeUs
+     * @param fromTimeUs Time of the first sample
+     * @param toTimeUs Time of the second sample
+     * @param timeUs Time to interpolate at (may lie beyond toTimeUs for extrapolation)
+     * @param maxValue Largest valid coordinate
+     * @return Interpolated coordinate clamped to 0..maxValue
+     */
+    static uint16_t interpolate(uint16_t fromValue, uint16_t toValue, unsigned long fromTimeUs, unsigned long toTimeUs, unsigned long timeUs, uint16_t maxValue);
+};
\ No newline at end of file
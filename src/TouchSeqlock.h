@@ -0,0 +1,61 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <atomic>
+#include <cstring>
+
+/**
+ * Touch frame slot protected by a seqlock, shared by the frame rings.
+ *
+ * Frame n is written with the sequence set to 2n+1 and then published as 2n+2. A reader copies the frame and checks
+ * the sequence again, so a copy torn by a concurrent write is detected and discarded instead of returned. There must
+ * be only one writer per slot.
+ *
+ * @tparam Sequence Unsigned sequence type, uint32_t where 64-bit atomics are not lock-free (wraps around) or uint64_t
+ */
+template <typename Sequence>
+struct TouchSeqlockSlot {
+    std::atomic<Sequence> sequence; // 2n+1 while frame n is being written, 2n+2 once it is complete
+    TouchFrame frame;               // Frame data
+
+    /**
+     * Writes frame n into the slot (writer only).
+     *
+     * @param frameSequence Sequence number n of the frame
+     * @param touches Active touch points
+     * @param count Number of active touch points
+     * @param timestampUs Time the frame was sampled at in microseconds
+     */
+    void write(Sequence frameSequence, const TouchPoint* touches, uint8_t count, unsigned long timestampUs) {
+        // Odd sequence marks the slot as being written, readers copying it concurrently discard their copy
+        sequence.store(2 * frameSequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        frame.assign(touches, count, timestampUs);
+
+        sequence.store(2 * frameSequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Copies frame n out of the slot if the slot still holds that frame.
+     *
+     * @param frameSequence Sequence number n of the frame
+     * @param result Receives the frame
+     * @return True if copied consistently, false if the writer has overwritten (or is overwriting) the slot
+     */
+    bool read(Sequence frameSequence, TouchFrame& result) const {
+        Sequence completeSequence = 2 * frameSequence + 2;
+
+        if (sequence.load(std::memory_order_acquire) != completeSequence) {
+            return false;
+        }
+
+        memcpy(&result, &frame, sizeof(TouchFrame));
+
+        // The copy is only consistent if the slot was not rewritten while copying it
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        return sequence.load(std::memory_order_relaxed) == completeSequence;
+    }
+};
\ No newline at end of file
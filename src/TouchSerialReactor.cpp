@@ -0,0 +1,307 @@
+#include "TouchSerialReactor.h"
+
+#ifdef DISPLAX_TOUCH_EPOLL
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <termios.h>
+#include <unistd.h>
+
+TouchFdStream::TouchFdStream(int fd)
+    : fd(fd) {
+}
+
+int TouchFdStream::available() {
+    return static_cast<int>(rxTail - rxHead);
+}
+
+int TouchFdStream::read() {
+    if (rxHead == rxTail) {
+        return -1;
+    }
+
+    return rxBuffer[rxHead++];
+}
+
+int TouchFdStream::peek() {
+    if (rxHead == rxTail) {
+        return -1;
+    }
+
+    return rxBuffer[rxHead];
+}
+
+size_t TouchFdStream::readBytes(uint8_t* buffer, size_t length) {
+    size_t count = rxTail - rxHead;
+
+    if (length < count) {
+        count = length;
+    }
+
+    memcpy(buffer, rxBuffer + rxHead, count);
+    rxHead += count;
+
+    return count;
+}
+
+size_t TouchFdStream::write(uint8_t byte) {
+    return write(&byte, 1);
+}
+
+size_t TouchFdStream::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+
+    while (written < size) {
+        ssize_t result = ::write(fd, buffer + written, size - written);
+
+        if (result > 0) {
+            written += static_cast<size_t>(result);
+        } else if (result < 0 && errno == EINTR) {
+            continue;
+        } else {
+            // Output buffer full or device gone, commands are resent by the driver's own timeouts
+            break;
+        }
+    }
+
+    return written;
+}
+
+int TouchFdStream::fill() {
+    if (!open) {
+        return -1;
+    }
+
+    // Move unconsumed data to the front so the read gets the whole free space
+    if (rxHead == rxTail) {
+        rxHead = 0;
+        rxTail = 0;
+    } else if (rxHead > 0) {
+        memmove(rxBuffer, rxBuffer + rxHead, rxTail - rxHead);
+        rxTail -= rxHead;
+        rxHead = 0;
+    }
+
+    if (rxTail == RX_BUFFER_SIZE) {
+        return 0;
+    }
+
+    ssize_t result;
+
+    do {
+        result = ::read(fd, rxBuffer + rxTail, RX_BUFFER_SIZE - rxTail);
+    } while (result < 0 && errno == EINTR);
+
+    if (result > 0) {
+        rxTail += static_cast<size_t>(result);
+
+        return static_cast<int>(result);
+    }
+
+    if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return 0;
+    }
+
+    // End of file or EIO after hangup
+    open = false;
+
+    return -1;
+}
+
+int TouchFdStream::getFd() const {
+    return fd;
+}
+
+bool TouchFdStream::isOpen() const {
+    return open;
+}
+
+TouchSerialReactor::~TouchSerialReactor() {
+    end();
+}
+
+bool TouchSerialReactor::begin() {
+    if (epollFd >= 0) {
+        return true;
+    }
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    return epollFd >= 0;
+}
+
+void TouchSerialReactor::end() {
+    if (epollFd >= 0) {
+        ::close(epollFd);
+        epollFd = -1;
+    }
+
+    sensorCount = 0;
+}
+
+bool TouchSerialReactor::addSensor(TouchFdStream& stream, DisplaxTouch& touch) {
+    if (epollFd < 0 || sensorCount >= MAX_SENSORS) {
+        return false;
+    }
+
+    for (uint8_t sensorIndex = 0; sensorIndex < sensorCount; sensorIndex++) {
+        if (sensors[sensorIndex].stream == &stream) {
+            return false;
+        }
+    }
+
+    int flags = fcntl(stream.getFd(), F_GETFL);
+
+    if (flags < 0 || fcntl(stream.getFd(), F_SETFL, flags | O_NONBLOCK) < 0) {
+        return false;
+    }
+
+    // Level-triggered: a device with more data than fits its buffer is simply reported again by the next poll()
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.ptr = &stream;
+
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, stream.getFd(), &event) != 0) {
+        return false;
+    }
+
+    sensors[sensorCount++] = {&stream, &touch};
+
+    return true;
+}
+
+bool TouchSerialReactor::removeSensor(TouchFdStream& stream) {
+    for (uint8_t sensorIndex = 0; sensorIndex < sensorCount; sensorIndex++) {
+        if (sensors[sensorIndex].stream != &stream) {
+            continue;
+        }
+
+        // Fails harmlessly if the device already hung up and was removed from the epoll set
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, stream.getFd(), nullptr);
+
+        sensors[sensorIndex] = sensors[--sensorCount];
+
+        return true;
+    }
+
+    return false;
+}
+
+uint8_t TouchSerialReactor::getSensorCount() const {
+    return sensorCount;
+}
+
+int TouchSerialReactor::poll(int timeoutMs) {
+    if (epollFd < 0) {
+        return -1;
+    }
+
+    epoll_event events[MAX_SENSORS];
+    int eventCount = epoll_wait(epollFd, events, MAX_SENSORS, timeoutMs);
+
+    if (eventCount < 0) {
+        if (errno != EINTR) {
+            return -1;
+        }
+
+        eventCount = 0;
+    }
+
+    int readyCount = 0;
+
+    for (int eventIndex = 0; eventIndex < eventCount; eventIndex++) {
+        TouchFdStream* stream = static_cast<TouchFdStream*>(events[eventIndex].data.ptr);
+        int result = stream->fill();
+
+        if (result > 0) {
+            readyCount++;
+        } else if (result < 0) {
+            // Hung up devices would otherwise be reported on every poll
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, stream->getFd(), nullptr);
+        }
+    }
+
+    // Process every complete report each device delivered, a single read can hold dozens of them
+    for (uint8_t sensorIndex = 0; sensorIndex < sensorCount; sensorIndex++) {
+        sensors[sensorIndex].touch->loop(ULONG_MAX);
+    }
+
+    return readyCount;
+}
+
+int TouchSerialReactor::openSerialPort(const char* path, uint32_t baudRate) {
+    speed_t speed;
+
+    switch (baudRate) {
+        case 9600:
+            speed = B9600;
+            break;
+
+        case 19200:
+            speed = B19200;
+            break;
+
+        case 38400:
+            speed = B38400;
+            break;
+
+        case 57600:
+            speed = B57600;
+            break;
+
+        case 115200:
+            speed = B115200;
+            break;
+
+        case 230400:
+            speed = B230400;
+            break;
+
+        case 460800:
+            speed = B460800;
+            break;
+
+        case 921600:
+            speed = B921600;
+            break;
+
+        default:
+            return -1;
+    }
+
+    int fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+
+    if (fd < 0) {
+        return -1;
+    }
+
+    termios settings;
+
+    if (tcgetattr(fd, &settings) != 0) {
+        ::close(fd);
+
+        return -1;
+    }
+
+    // Raw 8N1 without flow control or line discipline processing
+    cfmakeraw(&settings);
+    settings.c_cflag |= CLOCAL | CREAD;
+    settings.c_cflag &= ~(CSTOPB | CRTSCTS);
+    settings.c_cc[VMIN] = 0;
+    settings.c_cc[VTIME] = 0;
+    cfsetispeed(&settings, speed);
+    cfsetospeed(&settings, speed);
+
+    if (tcsetattr(fd, TCSANOW, &settings) != 0) {
+        ::close(fd);
+
+        return -1;
+    }
+
+    return fd;
+}
+
+#endif
\ No newline at end of file
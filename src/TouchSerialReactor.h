@@ -0,0 +1,175 @@
+#pragma once
+
+#include "DisplaxTouch.h"
+
+#include <Arduino.h>
+
+#if defined(__linux__) && !defined(DISPLAX_TOUCH_NO_EPOLL)
+#define DISPLAX_TOUCH_EPOLL 1
+#endif
+
+#ifdef DISPLAX_TOUCH_EPOLL
+
+/**
+ * Buffered Stream over a non-blocking file descriptor (Linux only).
+ *
+ * Lets a DisplaxTouch driver talk to a serial device or pseudo-terminal. Received data is not read by the stream
+ * itself: TouchSerialReactor fills the receive buffer with one large read() when epoll reports the descriptor ready,
+ * and the driver then parses it from memory. Writes go straight to the descriptor.
+ *
+ * The stream does not own the descriptor, close it after removing the stream from the reactor.
+ */
+class TouchFdStream : public Stream {
+  public:
+    static constexpr size_t RX_BUFFER_SIZE = 4096; // Receive buffer size, about 56 touch reports
+
+    /**
+     * Constructs a stream.
+     *
+     * @param fd Open file descriptor of the serial device, switched to non-blocking mode by TouchSerialReactor
+     */
+    explicit TouchFdStream(int fd);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(uint8_t* buffer, size_t length) override;
+    size_t write(uint8_t byte) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+
+    /**
+     * Reads whatever the descriptor has ready into the free part of the receive buffer.
+     *
+     * @return Number of bytes read, 0 if nothing was ready or the buffer is full, -1 if the device was closed or failed
+     */
+    int fill();
+
+    /**
+     * Gets the file descriptor.
+     *
+     * @return File descriptor passed to the constructor
+     */
+    int getFd() const;
+
+    /**
+     * Checks whether the device is still usable.
+     *
+     * @return False once a read reported hangup or an error
+     */
+    bool isOpen() const;
+
+  private:
+    int fd;                           // File descriptor of the serial device
+    bool open = true;                 // False after hangup or a read error
+    uint8_t rxBuffer[RX_BUFFER_SIZE]; // Received data not yet consumed by the driver
+    size_t rxHead = 0;                // Index of the next unread byte in rxBuffer
+    size_t rxTail = 0;                // Index one past the last received byte in rxBuffer
+};
+
+/**
+ * Single-thread epoll reactor driving many sensors (Linux only).
+ *
+ * For hosts aggregating dozens of panels through USB serial adapters, where a thread per device does not scale. Each
+ * poll() makes one epoll_wait() call for all registered devices, reads every ready device with one large non-blocking
+ * read() into its TouchFdStream and runs the drivers. Devices with nothing to read cost no syscalls.
+ *
+ * Example usage:
+ *
+ * @code
+ * int fd = TouchSerialReactor::openSerialPort("/dev/ttyUSB0", 115200);
+ * TouchFdStream stream(fd);
+ * DisplaxTouch touch(stream);
+ *
+ * TouchSerialReactor reactor;
+ * reactor.begin();
+ * reactor.addSensor(stream, touch);
+ * touch.begin();
+ *
+ * while (true) {
+ *     reactor.poll();
+ * }
+ * @endcode
+ */
+class TouchSerialReactor {
+  public:
+    static constexpr uint8_t MAX_SENSORS = 64;         // Maximum number of sensors per reactor
+    static constexpr int DEFAULT_POLL_TIMEOUT_MS = 10; // Default wait for data, bounds the driver timeout latency
+
+    TouchSerialReactor() = default;
+    ~TouchSerialReactor();
+
+    TouchSerialReactor(const TouchSerialReactor&) = delete;
+    TouchSerialReactor& operator=(const TouchSerialReactor&) = delete;
+
+    /**
+     * Creates the epoll instance.
+     *
+     * @return True on success
+     */
+    bool begin();
+
+    /** Removes all sensors and closes the epoll instance. */
+    void end();
+
+    /**
+     * Registers a sensor.
+     *
+     * Switches the descriptor to non-blocking mode. The stream and driver must outlive the registration.
+     *
+     * @param stream Stream the driver was constructed with
+     * @param touch Driver reading from the stream
+     * @return True if registered, false if not begun, full or the descriptor cannot be polled
+     */
+    bool addSensor(TouchFdStream& stream, DisplaxTouch& touch);
+
+    /**
+     * Unregisters a sensor.
+     *
+     * @param stream Stream passed to addSensor()
+     * @return True if the sensor was registered
+     */
+    bool removeSensor(TouchFdStream& stream);
+
+    /**
+     * Gets the number of registered sensors.
+     *
+     * @return Number of sensors
+     */
+    uint8_t getSensorCount() const;
+
+    /**
+     * Waits for data, reads all ready devices and runs every driver until it has processed all received reports.
+     *
+     * All drivers run on every call, not just the ones that received data, so their touch and connection timeouts keep
+     * working. Devices that hang up are removed from the epoll set and report isOpen() false, their drivers keep
+     * running so the touches are released by the timeout.
+     *
+     * @param timeoutMs Maximum time to wait for data in milliseconds, 0 to return immediately, -1 to wait indefinitely
+     * @return Number of devices that received data, -1 if epoll_wait() failed
+     */
+    int poll(int timeoutMs = DEFAULT_POLL_TIMEOUT_MS);
+
+    /**
+     * Opens a serial device in raw non-blocking mode.
+     *
+     * @param path Device path (e.g. "/dev/ttyUSB0" or a pseudo-terminal)
+     * @param baudRate Baud rate
+     * @return File descriptor, -1 if the device cannot be opened or the baud rate is not supported
+     */
+    static int openSerialPort(const char* path, uint32_t baudRate);
+
+  private:
+    /**
+     * Registered sensor.
+     */
+    struct Sensor {
+        TouchFdStream* stream; // Stream reading the device
+        DisplaxTouch* touch;   // Driver parsing the stream
+    };
+
+    int epollFd = -1;                 // epoll instance, -1 when not begun
+    Sensor sensors[MAX_SENSORS] = {}; // Registered sensors
+    uint8_t sensorCount = 0;          // Number of registered sensors
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "TouchShmRing.h"
+
+#ifdef DISPLAX_TOUCH_SHM
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory sequence numbers must be lock-free atomics");
+
+static constexpr size_t CACHE_LINE_SIZE = 64; // Padding of the ring header
+
+static size_t getSlotsOffset() {
+    return (sizeof(TouchShmHeader) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+}
+
+static size_t getMappingSize(uint32_t slotCount) {
+    return getSlotsOffset() + static_cast<size_t>(slotCount) * sizeof(TouchShmSlot);
+}
+
+TouchShmPublisher::~TouchShmPublisher() {
+    close();
+}
+
+bool TouchShmPublisher::open(const char* name, uint32_t newSlotCount) {
+    close();
+
+    if (name == nullptr || newSlotCount == 0) {
+        return false;
+    }
+
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    size_t size = getMappingSize(newSlotCount);
+    struct stat status;
+
+    // Resizing a ring that readers have mapped would fault them, so an incompatible ring is replaced by a new object
+    if (fstat(fd, &status) == 0 && status.st_size != 0 && static_cast<size_t>(status.st_size) != size) {
+        ::close(fd);
+        shm_unlink(name);
+        fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+
+        if (fd < 0) {
+            return false;
+        }
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    header = static_cast<TouchShmHeader*>(mapping);
+    slots = reinterpret_cast<TouchShmSlot*>(static_cast<uint8_t*>(mapping) + getSlotsOffset());
+    slotCount = newSlotCount;
+    mappedSize = size;
+
+    // Reopening a compatible ring continues its sequence, so attached readers just see the next frames
+    bool isCompatible = header->magic.load(std::memory_order_acquire) == MAGIC && header->version == VERSION &&
+                        header->slotCount == slotCount && header->slotSize == sizeof(TouchShmSlot);
+
+    if (!isCompatible) {
+        header->magic.store(0, std::memory_order_relaxed);
+        header->version = VERSION;
+        header->slotCount = slotCount;
+        header->slotSize = sizeof(TouchShmSlot);
+        header->publishedCount.store(0, std::memory_order_relaxed);
+
+        for (uint32_t slotIndex = 0; slotIndex < slotCount; slotIndex++) {
+            slots[slotIndex].sequence.store(0, std::memory_order_relaxed);
+        }
+
+        // Readers only trust the layout fields once they see the magic
+        header->magic.store(MAGIC, std::memory_order_release);
+    }
+
+    return true;
+}
+
+void TouchShmPublisher::close() {
+    if (touch != nullptr) {
+        touch->removeTouchListener(listenerId);
+        touch = nullptr;
+        listenerId = -1;
+    }
+
+    if (header != nullptr) {
+        munmap(header, mappedSize);
+        header = nullptr;
+        slots = nullptr;
+        slotCount = 0;
+        mappedSize = 0;
+    }
+}
+
+bool TouchShmPublisher::remove(const char* name) {
+    return name != nullptr && shm_unlink(name) == 0;
+}
+
+bool TouchShmPublisher::attach(DisplaxTouch& newTouch) {
+    if (header == nullptr || touch != nullptr) {
+        return false;
+    }
+
+    listenerId = newTouch.addTouchListener([this](const TouchPoint* touches, uint8_t count) {
+        publish(touches, count, touch->getFrameTimestamp());
+    });
+
+    if (listenerId < 0) {
+        return false;
+    }
+
+    touch = &newTouch;
+
+    return true;
+}
+
+void TouchShmPublisher::publish(const TouchPoint* touches, uint8_t count, unsigned long timestampUs) {
+    if (header == nullptr) {
+        return;
+    }
+
+    uint64_t sequence = header->publishedCount.load(std::memory_order_relaxed);
+    slots[sequence % slotCount].write(sequence, touches, count, timestampUs);
+    header->publishedCount.store(sequence + 1, std::memory_order_release);
+}
+
+uint64_t TouchShmPublisher::getPublishedCount() const {
+    return header != nullptr ? header->publishedCount.load(std::memory_order_acquire) : 0;
+}
+
+TouchShmReader::~TouchShmReader() {
+    close();
+}
+
+bool TouchShmReader::open(const char* name) {
+    close();
+
+    if (name == nullptr) {
+        return false;
+    }
+
+    int fd = shm_open(name, O_RDONLY, 0);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat status;
+
+    if (fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < getSlotsOffset()) {
+        ::close(fd);
+
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(status.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    const TouchShmHeader* mappedHeader = static_cast<const TouchShmHeader*>(mapping);
+
+    if (mappedHeader->magic.load(std::memory_order_acquire) != TouchShmPublisher::MAGIC || mappedHeader->version != TouchShmPublisher::VERSION ||
+        mappedHeader->slotSize != sizeof(TouchShmSlot) || mappedHeader->slotCount == 0 ||
+        getMappingSize(mappedHeader->slotCount) > size) {
+        munmap(mapping, size);
+
+        return false;
+    }
+
+    header = mappedHeader;
+    slots = reinterpret_cast<const TouchShmSlot*>(static_cast<const uint8_t*>(mapping) + getSlotsOffset());
+    slotCount = header->slotCount;
+    mappedSize = size;
+    nextSequence = header->publishedCount.load(std::memory_order_acquire);
+    lastSequence = 0;
+    missedFrameCount = 0;
+
+    return true;
+}
+
+void TouchShmReader::close() {
+    if (header != nullptr) {
+        munmap(const_cast<TouchShmHeader*>(header), mappedSize);
+        header = nullptr;
+        slots = nullptr;
+        slotCount = 0;
+        mappedSize = 0;
+    }
+}
+
+bool TouchShmReader::read(TouchFrame& frame) {
+    if (header == nullptr) {
+        return false;
+    }
+
+    while (true) {
+        uint64_t publishedCount = header->publishedCount.load(std::memory_order_acquire);
+
+        if (nextSequence >= publishedCount) {
+            return false;
+        }
+
+        // Lapped by the publisher: the oldest frames still in the ring follow the newest slotCount frames
+        if (publishedCount - nextSequence > slotCount) {
+            missedFrameCount += publishedCount - slotCount - nextSequence;
+            nextSequence = publishedCount - slotCount;
+        }
+
+        if (copyFrame(nextSequence, frame)) {
+            lastSequence = nextSequence++;
+
+            return true;
+        }
+
+        // Overwritten while copying, the frame is lost
+        missedFrameCount++;
+        nextSequence++;
+    }
+}
+
+bool TouchShmReader::readLatest(TouchFrame& frame) {
+    if (header == nullptr) {
+        return false;
+    }
+
+    while (true) {
+        uint64_t publishedCount = header->publishedCount.load(std::memory_order_acquire);
+
+        if (nextSequence >= publishedCount) {
+            return false;
+        }
+
+        if (copyFrame(publishedCount - 1, frame)) {
+            lastSequence = publishedCount - 1;
+            nextSequence = publishedCount;
+
+            return true;
+        }
+    }
+}
+
+uint64_t TouchShmReader::getSequence() const {
+    return lastSequence;
+}
+
+uint64_t TouchShmReader::getMissedFrameCount() const {
+    return missedFrameCount;
+}
+
+bool TouchShmReader::copyFrame(uint64_t sequence, TouchFrame& frame) const {
+    return slots[sequence % slotCount].read(sequence, frame);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "DisplaxTouch.h"
+
+#include <Arduino.h>
+
+#if defined(__linux__) && !defined(DISPLAX_TOUCH_NO_SHM)
+#define DISPLAX_TOUCH_SHM 1
+#endif
+
+#ifdef DISPLAX_TOUCH_SHM
+
+#include "TouchSeqlock.h"
+
+#include <atomic>
+
+/**
+ * Header at the start of a touch frame ring in shared memory.
+ */
+struct TouchShmHeader {
+    std::atomic<uint32_t> magic;          // TouchShmPublisher::MAGIC once the ring is initialized, published last
+    uint32_t version;                     // Layout version, TouchShmPublisher::VERSION
+    uint32_t slotCount;                   // Number of frame slots following the header
+    uint32_t slotSize;                    // Size of one slot in bytes, guards against layout mismatches
+    std::atomic<uint64_t> publishedCount; // Number of frames published, frame n is stored in slot n % slotCount
+};
+
+/** Frame slot of a touch frame ring, 64-bit sequences never wrap around. */
+using TouchShmSlot = TouchSeqlockSlot<uint64_t>;
+
+/**
+ * Publishes touch frames into a shared memory ring for other processes (Linux only).
+ *
+ * Frames are written into a fixed ring of slots in a POSIX shared memory object (/dev/shm/<name>). Each slot is
+ * guarded by a seqlock and frames carry monotonically increasing sequence numbers, so any number of TouchShmReader
+ * processes can read the stream without locks, syscalls or re-encoding, and a slow reader never blocks the publisher.
+ * There must be only one publisher per ring.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchShmPublisher publisher;
+ * publisher.open("/displax-touch");
+ * publisher.attach(touch);
+ *
+ * while (true) {
+ *     touch.loop();
+ * }
+ * @endcode
+ */
+class TouchShmPublisher {
+  public:
+    static constexpr uint32_t MAGIC = 0x44585452;       // "DXTR", marks an initialized ring
+    static constexpr uint32_t VERSION = 1;              // Shared memory layout version
+    static constexpr uint32_t DEFAULT_SLOT_COUNT = 256; // Default number of frame slots
+
+    TouchShmPublisher() = default;
+    ~TouchShmPublisher();
+
+    TouchShmPublisher(const TouchShmPublisher&) = delete;
+    TouchShmPublisher& operator=(const TouchShmPublisher&) = delete;
+
+    /**
+     * Creates or replaces the shared memory ring.
+     *
+     * @param name Shared memory object name, starting with a slash (e.g. "/displax-touch")
+     * @param slotCount Number of frames the ring holds
+     * @return True on success, false if the shared memory object could not be created or mapped
+     */
+    bool open(const char* name, uint32_t slotCount = DEFAULT_SLOT_COUNT);
+
+    /** Detaches from the driver and unmaps the ring, the shared memory object stays available to readers. */
+    void close();
+
+    /**
+     * Removes a shared memory object.
+     *
+     * @param name Shared memory object name
+     * @return True if removed
+     */
+    static bool remove(const char* name);
+
+    /**
+     * Publishes every touch frame of a driver.
+     *
+     * @param touch Driver to publish, must outlive the attachment
+     * @return True if attached, false if the ring is not open or the driver has no free listener slot
+     */
+    bool attach(DisplaxTouch& touch);
+
+    /**
+     * Publishes a touch frame.
+     *
+     * @param touches Active touch points
+     * @param count Number of active touch points
+     * @param timestampUs Time the frame was sampled at in microseconds
+     */
+    void publish(const TouchPoint* touches, uint8_t count, unsigned long timestampUs);
+
+    /**
+     * Gets the number of frames published to the ring.
+     *
+     * @return Sequence number of the next frame
+     */
+    uint64_t getPublishedCount() const;
+
+  private:
+    TouchShmHeader* header = nullptr; // Mapped ring header, nullptr when not open
+    TouchShmSlot* slots = nullptr;    // Mapped frame slots
+    uint32_t slotCount = 0;           // Number of frame slots
+    size_t mappedSize = 0;            // Size of the mapping in bytes
+    DisplaxTouch* touch = nullptr;    // Attached driver
+    int listenerId = -1;              // Listener publishing the attached driver's frames
+};
+
+/**
+ * Reads touch frames from a shared memory ring written by TouchShmPublisher (Linux only).
+ *
+ * Reading is lock-free and makes no syscalls: the reader checks the slot's seqlock, copies the frame out of the shared
+ * mapping and checks the seqlock again, retrying if the publisher overwrote the slot meanwhile. A reader that falls
+ * more than a ring length behind skips the overwritten frames and counts them as missed.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchShmReader reader;
+ * reader.open("/displax-touch");
+ *
+ * TouchFrame frame;
+ * while (reader.read(frame)) {
+ *     // Handle frame.touches[0..frame.count-1]
+ * }
+ * @endcode
+ */
+class TouchShmReader {
+  public:
+    TouchShmReader() = default;
+    ~TouchShmReader();
+
+    TouchShmReader(const TouchShmReader&) = delete;
+    TouchShmReader& operator=(const TouchShmReader&) = delete;
+
+    /**
+     * Maps an existing ring, reading starts with the next published frame.
+     *
+     * @param name Shared memory object name used by the publisher
+     * @return True on success, false if the ring does not exist or has an incompatible layout
+     */
+    bool open(const char* name);
+
+    /** Unmaps the ring. */
+    void close();
+
+    /**
+     * Reads the next unread frame.
+     *
+     * @param frame Receives the frame
+     * @return True if a frame was read, false if no new frame has been published
+     */
+    bool read(TouchFrame& frame);
+
+    /**
+     * Reads the newest frame, skipping any unread older frames.
+     *
+     * Useful for consumers that only need the current touches, such as a renderer sampling once per display frame.
+     *
+     * @param frame Receives the frame
+     * @return True if a new frame was read, false if no new frame has been published
+     */
+    bool readLatest(TouchFrame& frame);
+
+    /**
+     * Gets the sequence number of the last frame read.
+     *
+     * @return Sequence number assigned by the publisher
+     */
+    uint64_t getSequence() const;
+
+    /**
+     * Gets the number of frames overwritten before this reader could read them.
+     *
+     * @return Number of missed frames since open()
+     */
+    uint64_t getMissedFrameCount() const;
+
+  private:
+    const TouchShmHeader* header = nullptr; // Mapped ring header, nullptr when not open
+    const TouchShmSlot* slots = nullptr;    // Mapped frame slots
+    uint32_t slotCount = 0;                 // Number of frame slots
+    size_t mappedSize = 0;                  // Size of the mapping in bytes
+    uint64_t nextSequence = 0;              // Sequence number of the next frame to read
+    uint64_t lastSequence = 0;              // Sequence number of the last frame read
+    uint64_t missedFrameCount = 0;          // Frames overwritten before they were read
+
+    /**
+     * Copies a frame out of its slot if the slot still holds that frame.
+     *
+     * Fails only if the publisher has lapped the reader and overwritten (or is overwriting) the slot.
+     *
+     * @param sequence Sequence number of the frame
+     * @param frame Receives the frame
+     * @return True if copied consistently
+     */
+    bool copyFrame(uint64_t sequence, TouchFrame& frame) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "TouchTransformSolver.h"
+
+#include <math.h>
+
+TouchTransformSolver::TouchTransformSolver() {
+    setIdentity(delta);
+    setIdentity(accumulated);
+}
+
+bool TouchTransformSolver::update(const TouchPoint* touches, uint8_t count) {
+    if (count > MAX_TOUCHES) {
+        count = MAX_TOUCHES;
+    }
+
+    // Match contacts by id and accumulate the sums of the least-squares fit in a single pass. Coordinates are taken
+    // relative to the first matched contact to keep the float sums well conditioned.
+    uint8_t matched = 0;
+    float originX = 0.0f;
+    float originY = 0.0f;
+    float sumFromX = 0.0f;
+    float sumFromY = 0.0f;
+    float sumToX = 0.0f;
+    float sumToY = 0.0f;
+    float sumDot = 0.0f;
+    float sumCross = 0.0f;
+    float sumFromSquared = 0.0f;
+
+    for (uint8_t touchIndex = 0; touchIndex < count; touchIndex++) {
+        const TouchPoint& touch = touches[touchIndex];
+
+        for (uint8_t previousIndex = 0; previousIndex < previousCount; previousIndex++) {
+            if (previousIds[previousIndex] != touch.id) {
+                continue;
+            }
+
+            if (matched == 0) {
+                originX = previousXs[previousIndex];
+                originY = previousYs[previousIndex];
+            }
+
+            float fromX = previousXs[previousIndex] - originX;
+            float fromY = previousYs[previousIndex] - originY;
+            float toX = touch.x - originX;
+            float toY = touch.y - originY;
+
+            sumFromX += fromX;
+            sumFromY += fromY;
+            sumToX += toX;
+            sumToY += toY;
+            sumDot += fromX * toX + fromY * toY;
+            sumCross += fromX * toY - fromY * toX;
+            sumFromSquared += fromX * fromX + fromY * fromY;
+            matched++;
+            break;
+        }
+    }
+
+    // Remember this frame for the next fit
+    previousCount = count;
+
+    for (uint8_t touchIndex = 0; touchIndex < count; touchIndex++) {
+        previousIds[touchIndex] = touches[touchIndex].id;
+        previousXs[touchIndex] = touches[touchIndex].x;
+        previousYs[touchIndex] = touches[touchIndex].y;
+    }
+
+    setIdentity(delta);
+
+    if (matched == 0) {
+        return false;
+    }
+
+    // Translation is the centroid movement; scale and rotation follow from the centered sums:
+    // a = sum(p . q) / sum(|p|^2), b = sum(p x q) / sum(|p|^2) with p, q relative to their centroids
+    float inverseCount = 1.0f / matched;
+    float fromCentroidX = sumFromX * inverseCount;
+    float fromCentroidY = sumFromY * inverseCount;
+    float toCentroidX = sumToX * inverseCount;
+    float toCentroidY = sumToY * inverseCount;
+
+    delta.translateX = toCentroidX - fromCentroidX;
+    delta.translateY = toCentroidY - fromCentroidY;
+    delta.pivotX = fromCentroidX + originX;
+    delta.pivotY = fromCentroidY + originY;
+    delta.contacts = matched;
+
+    float centeredFromSquared = sumFromSquared - matched * (fromCentroidX * fromCentroidX + fromCentroidY * fromCentroidY);
+
+    if (matched >= 2 && centeredFromSquared > 0.0f) {
+        float centeredDot = sumDot - matched * (fromCentroidX * toCentroidX + fromCentroidY * toCentroidY);
+        float centeredCross = sumCross - matched * (fromCentroidX * toCentroidY - fromCentroidY * toCentroidX);
+        float a = centeredDot / centeredFromSquared;
+        float b = centeredCross / centeredFromSquared;
+
+        delta.scale = sqrtf(a * a + b * b);
+        delta.rotation = atan2f(b, a);
+    }
+
+    accumulated.translateX += delta.translateX;
+    accumulated.translateY += delta.translateY;
+    accumulated.scale *= delta.scale;
+    accumulated.rotation += delta.rotation;
+    accumulated.pivotX = delta.pivotX;
+    accumulated.pivotY = delta.pivotY;
+    accumulated.contacts = delta.contacts;
+
+    return true;
+}
+
+const TouchTransform& TouchTransformSolver::getDelta() const {
+    return delta;
+}
+
+const TouchTransform& TouchTransformSolver::getAccumulated() const {
+    return accumulated;
+}
+
+void TouchTransformSolver::resetAccumulated() {
+    setIdentity(accumulated);
+}
+
+void TouchTransformSolver::reset() {
+    previousCount = 0;
+    setIdentity(delta);
+    setIdentity(accumulated);
+}
+
+void TouchTransformSolver::setIdentity(TouchTransform& transform) {
+    transform.translateX = 0.0f;
+    transform.translateY = 0.0f;
+    transform.scale = 1.0f;
+    transform.rotation = 0.0f;
+    transform.pivotX = 0.0f;
+    transform.pivotY = 0.0f;
+    transform.contacts = 0;
+}
\ No newline at end of file
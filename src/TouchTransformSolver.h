@@ -0,0 +1,102 @@
+#pragma once
+
+#include "TouchPoint.h"
+
+#include <Arduino.h>
+
+/**
+ * Similarity transform (translation, uniform scale and rotation) between two touch frames.
+ *
+ * Maps a point p of the previous frame to pivot + translation + scale * R(rotation) * (p - pivot).
+ */
+struct TouchTransform {
+    float translateX; // Movement of the contact centroid along x in sensor units
+    float translateY; // Movement of the contact centroid along y in sensor units
+    float scale;      // Uniform scale factor (1.0 when unchanged)
+    float rotation;   // Counterclockwise rotation in radians (in sensor coordinates)
+    float pivotX;     // X coordinate of the rotation and scale center (previous contact centroid)
+    float pivotY;     // Y coordinate of the rotation and scale center (previous contact centroid)
+    uint8_t contacts; // Number of contacts the transform was fitted to (0 when no contact was tracked)
+};
+
+/**
+ * Fits a multi-finger pan, pinch and rotate gesture across all contacts.
+ *
+ * Instead of deriving pinch and rotation from the first two touches, each frame is matched by contact id against the
+ * previous one and the closed-form least-squares similarity transform over all tracked contacts is computed. The fit
+ * needs a single pass of sums over the contacts, so it is cheap enough to run on every frame.
+ *
+ * Contacts that appear or disappear between frames are excluded from that frame's fit, so adding or lifting a finger
+ * does not make the gesture jump. With a single tracked contact the transform is a pure translation.
+ *
+ * Example usage:
+ *
+ * @code
+ * TouchTransformSolver solver;
+ *
+ * touch.addTouchListener([](const TouchPoint* touches, uint8_t count) {
+ *     if (solver.update(touches, count)) {
+ *         const TouchTransform& delta = solver.getDelta();
+ *         view.pan(delta.translateX, delta.translateY);
+ *         view.zoom(delta.scale, delta.pivotX, delta.pivotY);
+ *         view.rotate(delta.rotation, delta.pivotX, delta.pivotY);
+ *     }
+ * });
+ * @endcode
+ */
+class TouchTransformSolver {
+  public:
+    static constexpr uint8_t MAX_TOUCHES = 6; // Maximum simultaneous touch points supported by the protocol
+
+    /**
+     * Constructs a solver with an identity accumulated transform.
+     */
+    TouchTransformSolver();
+
+    /**
+     * Adds a touch frame and fits the transform from the previous frame.
+     *
+     * @param touches Touch points in the frame
+     * @param count Number of touch points (0 when all contacts have been released)
+     * @return True if at least one contact was tracked across both frames and getDelta() was updated
+     */
+    bool update(const TouchPoint* touches, uint8_t count);
+
+    /**
+     * Gets the transform between the previous frame and the latest frame.
+     *
+     * @return Per-frame delta (identity when update() returned false)
+     */
+    const TouchTransform& getDelta() const;
+
+    /**
+     * Gets the composition of all deltas since construction or the last resetAccumulated().
+     *
+     * The accumulated translation is the sum of the centroid movements, scale is the product of the scale factors and
+     * rotation is the sum of the rotations, which is what an application typically applies to a manipulated object.
+     *
+     * @return Accumulated transform (pivot and contacts describe the latest delta)
+     */
+    const TouchTransform& getAccumulated() const;
+
+    /** Resets the accumulated transform to identity, keeping the tracked contacts. */
+    void resetAccumulated();
+
+    /** Forgets the tracked contacts and resets both transforms to identity. */
+    void reset();
+
+  private:
+    uint8_t previousCount = 0;             // Number of contacts in the previous frame
+    uint8_t previousIds[MAX_TOUCHES] = {}; // Contact ids of the previous frame
+    uint16_t previousXs[MAX_TOUCHES] = {}; // Contact x coordinates of the previous frame
+    uint16_t previousYs[MAX_TOUCHES] = {}; // Contact y coordinates of the previous frame
+    TouchTransform delta;                  // Transform between the previous and the latest frame
+    TouchTransform accumulated;            // Composition of all deltas
+
+    /**
+     * Sets a transform to identity.
+     *
+     * @param transform Transform to reset
+     */
+    static void setIdentity(TouchTransform& transform);
+};
\ No newline at end of file
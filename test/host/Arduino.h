@@ -0,0 +1,114 @@
+#pragma once
+
+/**
+ * Minimal Arduino core for running the unit tests on a host (pio test -e native).
+ *
+ * Provides only what the library uses: String, Print, Stream, millis() and micros().
+ */
+
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+
+class String {
+  public:
+    String() = default;
+
+    String(const char* value)
+        : value(value) {
+    }
+
+    String(int value)
+        : value(std::to_string(value)) {
+    }
+
+    String(unsigned int value)
+        : value(std::to_string(value)) {
+    }
+
+    String operator+(const String& other) const {
+        return String(value + other.value);
+    }
+
+    String operator+(const char* other) const {
+        return String(value + other);
+    }
+
+    String operator+(int other) const {
+        return String(value + std::to_string(other));
+    }
+
+    String& operator+=(const String& other) {
+        value += other.value;
+
+        return *this;
+    }
+
+    String& operator+=(const char* other) {
+        value += other;
+
+        return *this;
+    }
+
+    unsigned int length() const {
+        return static_cast<unsigned int>(value.size());
+    }
+
+    const char* c_str() const {
+        return value.c_str();
+    }
+
+  private:
+    explicit String(std::string value)
+        : value(std::move(value)) {
+    }
+
+    std::string value; // String contents
+};
+
+class Print {
+  public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t byte) = 0;
+
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t written = 0;
+
+        while (written < size && write(buffer[written]) == 1) {
+            written++;
+        }
+
+        return written;
+    }
+
+    virtual void flush() {
+    }
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(uint8_t* buffer, size_t length) {
+        size_t count = 0;
+
+        while (count < length && available() > 0) {
+            buffer[count++] = static_cast<uint8_t>(read());
+        }
+
+        return count;
+    }
+};
+
+inline unsigned long millis() {
+    return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+inline unsigned long micros() {
+    return static_cast<unsigned long>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Contact of a simulated touch report.
+ */
+struct TouchTestContact {
+    uint8_t id;         // Touch point identifier
+    uint16_t x;         // X coordinate in sensor units
+    uint16_t y;         // Y coordinate in sensor units
+    uint16_t pressure;  // Touch pressure value
+    bool isDown = true; // False to report the contact as lifted (tip switch cleared)
+};
+
+/**
+ * Protocol-level model of a Displax sensor for tests.
+ *
+ * Answers the driver's initialization commands like the real sensor and encodes CRC-valid touch reports. It is
+ * transport independent: tests feed it the bytes the driver writes and deliver the bytes it produces through an
+ * in-memory stream or a pseudo-terminal.
+ */
+class TouchSensorModel {
+  public:
+    static constexpr size_t TOUCH_REPORT_SIZE = 72; // Touch report size (4 header + 64 payload + 4 CRC)
+    static constexpr uint16_t SCAN_TIME_STEP = 100; // Scan time advance per report (10 ms in 100 us units)
+
+    /**
+     * Constructs a sensor model.
+     *
+     * @param frameWidth Frame width reported to GET_FRAME_SIZE
+     * @param frameHeight Frame height reported to GET_FRAME_SIZE
+     */
+    explicit TouchSensorModel(uint16_t frameWidth = 16383, uint16_t frameHeight = 9599)
+        : frameWidth(frameWidth)
+        , frameHeight(frameHeight) {
+    }
+
+    /**
+     * Handles bytes written by the driver and appends the responses.
+     *
+     * @param data Bytes written by the driver, commands may be split across calls
+     * @param length Number of bytes
+     * @param output Receives the response bytes
+     */
+    void receive(const uint8_t* data, size_t length, std::vector<uint8_t>& output) {
+        if (!responding) {
+            return;
+        }
+
+        for (size_t index = 0; index < length; index++) {
+            pendingCommand.push_back(data[index]);
+
+            if (pendingCommand.size() < 2) {
+                continue;
+            }
+
+            respond(static_cast<uint16_t>(pendingCommand[0] | (pendingCommand[1] << 8)), output);
+            pendingCommand.clear();
+        }
+    }
+
+    /**
+     * Appends a touch report, advancing the scan time.
+     *
+     * @param contacts Contacts in the report (at most 6)
+     * @param count Number of contacts
+     * @param output Receives the report bytes
+     */
+    void appendTouchReport(const TouchTestContact* contacts, uint8_t count, std::vector<uint8_t>& output) {
+        uint8_t report[TOUCH_REPORT_SIZE] = {0x04, 0x00, 0x40, 0x00};
+        uint8_t* payload = report + 4;
+
+        payload[0] = 0x04;
+
+        for (uint8_t contactIndex = 0; contactIndex < count && contactIndex < 6; contactIndex++) {
+            const TouchTestContact& contact = contacts[contactIndex];
+            uint8_t* touchData = payload + 1 + contactIndex * 10;
+
+            touchData[0] = contact.isDown ? 0x01 : 0x00;
+            touchData[1] = contact.id;
+            touchData[2] = static_cast<uint8_t>(contact.x);
+            touchData[3] = static_cast<uint8_t>(contact.x >> 8);
+            touchData[4] = static_cast<uint8_t>(contact.y);
+            touchData[5] = static_cast<uint8_t>(contact.y >> 8);
+            touchData[6] = 10;
+            touchData[7] = 10;
+            touchData[8] = static_cast<uint8_t>(contact.pressure);
+            touchData[9] = static_cast<uint8_t>(contact.pressure >> 8);
+        }
+
+        scanTime += SCAN_TIME_STEP;
+        payload[61] = count < 6 ? count : 6;
+        payload[62] = static_cast<uint8_t>(scanTime);
+        payload[63] = static_cast<uint8_t>(scanTime >> 8);
+
+        uint32_t crc = calculateCRC32(report, TOUCH_REPORT_SIZE - 4);
+
+        for (uint8_t byteIndex = 0; byteIndex < 4; byteIndex++) {
+            report[TOUCH_REPORT_SIZE - 4 + byteIndex] = static_cast<uint8_t>(crc >> (byteIndex * 8));
+        }
+
+        output.insert(output.end(), report, report + TOUCH_REPORT_SIZE);
+    }
+
+    /**
+     * Makes the sensor ignore commands, like a sensor that is not powered.
+     *
+     * @param isResponding False to ignore commands
+     */
+    void setResponding(bool isResponding) {
+        responding = isResponding;
+    }
+
+    /**
+     * Checks whether the driver has enabled touch reporting.
+     *
+     * @return True once ENABLE_REPORTING was received
+     */
+    bool isReporting() const {
+        return reporting;
+    }
+
+  private:
+    uint16_t frameWidth;                 // Reported frame width
+    uint16_t frameHeight;                // Reported frame height
+    uint16_t scanTime = 0;               // Scan time of the last report
+    bool reporting = false;              // Whether touch reporting is enabled
+    bool responding = true;              // Whether commands are answered
+    std::vector<uint8_t> pendingCommand; // Partially received command
+
+    /**
+     * Appends the response to a command.
+     *
+     * @param command Command code
+     * @param output Receives the response bytes
+     */
+    void respond(uint16_t command, std::vector<uint8_t>& output) {
+        switch (command) {
+            case 0x0000:
+                // RESET answers with its own response id
+                reporting = false;
+                output.insert(output.end(), {0x6E, 0x22});
+                break;
+
+            case 0x0003:
+                output.insert(output.end(), {0x03, 0x00, static_cast<uint8_t>(frameWidth), static_cast<uint8_t>(frameWidth >> 8), static_cast<uint8_t>(frameHeight), static_cast<uint8_t>(frameHeight >> 8)});
+                break;
+
+            case 0x0005:
+                reporting = true;
+                output.insert(output.end(), {0x05, 0x00});
+                break;
+
+            case 0x0006:
+                reporting = false;
+                output.insert(output.end(), {0x06, 0x00});
+                break;
+
+            case 0xFF00:
+            case 0xFF01:
+                output.insert(output.end(), {static_cast<uint8_t>(command), static_cast<uint8_t>(command >> 8)});
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /**
+     * Calculates the report CRC independently of the driver (bitwise, Ethernet polynomial over little-endian words).
+     *
+     * @param data Data to checksum
+     * @param length Length of data (multiple of 4)
+     * @return CRC32 value
+     */
+    static uint32_t calculateCRC32(const uint8_t* data, size_t length) {
+        uint32_t crc = 0xFFFFFFFF;
+
+        for (size_t offset = 0; offset < length; offset += 4) {
+            crc ^= static_cast<uint32_t>(data[offset]) | (static_cast<uint32_t>(data[offset + 1]) << 8) | (static_cast<uint32_t>(data[offset + 2]) << 16) | (static_cast<uint32_t>(data[offset + 3]) << 24);
+
+            for (uint8_t bit = 0; bit < 32; bit++) {
+                crc = (crc & 0x80000000) != 0 ? (crc << 1) ^ 0x04C11DB7 : crc << 1;
+            }
+        }
+
+        return crc;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "TouchSensorModel.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/**
+ * Simulated sensor behind a pseudo-terminal.
+ *
+ * Opens a PTY pair with posix_openpt(), the driver opens the slave side as if it were a USB serial adapter. service()
+ * answers the commands the driver wrote with a TouchSensorModel, so the real handshake runs over the terminal, and
+ * sendTouchReport() writes CRC-valid touch reports to it.
+ */
+class TouchSensorSimulator {
+  public:
+    TouchSensorSimulator() = default;
+
+    ~TouchSensorSimulator() {
+        close();
+    }
+
+    TouchSensorSimulator(const TouchSensorSimulator&) = delete;
+    TouchSensorSimulator& operator=(const TouchSensorSimulator&) = delete;
+
+    /**
+     * Opens the pseudo-terminal pair with a freshly powered sensor behind it.
+     *
+     * @return True on success
+     */
+    bool open() {
+        sensor = TouchSensorModel();
+        masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+
+        if (masterFd < 0) {
+            return false;
+        }
+
+        int flags = fcntl(masterFd, F_GETFL);
+
+        if (grantpt(masterFd) != 0 || unlockpt(masterFd) != 0 || flags < 0 || fcntl(masterFd, F_SETFL, flags | O_NONBLOCK) != 0) {
+            close();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    /** Closes the master side, the driver's device reports a hangup. */
+    void close() {
+        if (masterFd >= 0) {
+            ::close(masterFd);
+            masterFd = -1;
+        }
+    }
+
+    /**
+     * Gets the path of the slave device the driver should open.
+     *
+     * @return Device path, nullptr if not open
+     */
+    const char* getDevicePath() const {
+        return masterFd >= 0 ? ptsname(masterFd) : nullptr;
+    }
+
+    /** Answers every command the driver has written so far. */
+    void service() {
+        uint8_t buffer[256];
+        ssize_t length;
+
+        while ((length = ::read(masterFd, buffer, sizeof(buffer))) > 0) {
+            std::vector<uint8_t> response;
+            sensor.receive(buffer, static_cast<size_t>(length), response);
+            send(response);
+        }
+    }
+
+    /**
+     * Writes a touch report to the terminal.
+     *
+     * @param contacts Contacts in the report
+     * @param count Number of contacts
+     */
+    void sendTouchReport(const TouchTestContact* contacts, uint8_t count) {
+        std::vector<uint8_t> report;
+        sensor.appendTouchReport(contacts, count, report);
+        send(report);
+    }
+
+    /**
+     * Gets the simulated sensor.
+     *
+     * @return Sensor model answering the driver
+     */
+    TouchSensorModel& getSensor() {
+        return sensor;
+    }
+
+  private:
+    TouchSensorModel sensor; // Simulated sensor answering commands
+    int masterFd = -1;       // Master side of the pseudo-terminal, -1 when closed
+
+    /**
+     * Writes bytes to the terminal, waiting while its buffer is full.
+     *
+     * @param data Bytes to write
+     */
+    void send(const std::vector<uint8_t>& data) {
+        size_t written = 0;
+
+        while (written < data.size()) {
+            ssize_t result = ::write(masterFd, data.data() + written, data.size() - written);
+
+            if (result > 0) {
+                written += static_cast<size_t>(result);
+            } else if (result < 0 && errno != EAGAIN && errno != EINTR) {
+                break;
+            } else {
+                usleep(100);
+            }
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "TouchSensorModel.h"
+
+#include <Arduino.h>
+#include <deque>
+
+/**
+ * In-memory Stream connected to a simulated sensor.
+ *
+ * Commands written by the driver are answered by a TouchSensorModel, so begin() followed by a few loop() calls
+ * completes the real initialization handshake. Touch reports are queued with pushTouchReport().
+ */
+class TouchTestStream : public Stream {
+  public:
+    int available() override {
+        return static_cast<int>(input.size());
+    }
+
+    int read() override {
+        if (input.empty()) {
+            return -1;
+        }
+
+        uint8_t byte = input.front();
+        input.pop_front();
+
+        return byte;
+    }
+
+    int peek() override {
+        return input.empty() ? -1 : input.front();
+    }
+
+    size_t write(uint8_t byte) override {
+        return write(&byte, 1);
+    }
+
+    size_t write(const uint8_t* buffer, size_t size) override {
+        std::vector<uint8_t> response;
+        sensor.receive(buffer, size, response);
+        input.insert(input.end(), response.begin(), response.end());
+
+        return size;
+    }
+
+    /**
+     * Queues a touch report.
+     *
+     * @param contacts Contacts in the report
+     * @param count Number of contacts
+     */
+    void pushTouchReport(const TouchTestContact* contacts, uint8_t count) {
+        std::vector<uint8_t> report;
+        sensor.appendTouchReport(contacts, count, report);
+        input.insert(input.end(), report.begin(), report.end());
+    }
+
+    /**
+     * Gets the simulated sensor.
+     *
+     * @return Sensor model answering the driver
+     */
+    TouchSensorModel& getSensor() {
+        return sensor;
+    }
+
+  private:
+    TouchSensorModel sensor;   // Simulated sensor answering commands
+    std::deque<uint8_t> input; // Bytes waiting to be read by the driver
+};
\ No newline at end of file
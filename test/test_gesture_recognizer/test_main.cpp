@@ -0,0 +1,135 @@
+#include "TouchGestureRecognizer.h"
+
+#include <unity.h>
+
+enum Gesture : uint8_t {
+    GESTURE_CIRCLE = 1,
+    GESTURE_CHECK,
+    GESTURE_CROSS,
+    GESTURE_LINE
+};
+
+// Templates, drawn in abstract units
+static const uint16_t CIRCLE_TEMPLATE_XS[] = {500, 218, 100, 218, 500, 782, 900, 782, 500};
+static const uint16_t CIRCLE_TEMPLATE_YS[] = {100, 218, 500, 782, 900, 782, 500, 218, 100};
+static const uint16_t CHECK_TEMPLATE_XS[] = {0, 100, 300};
+static const uint16_t CHECK_TEMPLATE_YS[] = {200, 300, 0};
+static const uint16_t CROSS_TEMPLATE_XS[] = {0, 400, 400, 0};
+static const uint16_t CROSS_TEMPLATE_YS[] = {0, 400, 0, 400};
+static const uint8_t CROSS_TEMPLATE_STROKES[] = {0, 0, 1, 1};
+static const uint16_t LINE_TEMPLATE_XS[] = {0, 500};
+static const uint16_t LINE_TEMPLATE_YS[] = {0, 0};
+
+// Strokes recorded from a sensor in sensor units, one point per frame
+static const uint16_t CIRCLE_XS[] = {5181, 4867, 4516, 4340, 4018, 3907, 3842, 3717, 3737, 3886, 4036, 4305, 4517, 4889, 5168,
+                                     5542, 5776, 6118, 6279, 6451, 6662, 6627, 6571, 6461, 6312, 6148, 5792, 5536, 5221};
+static const uint16_t CIRCLE_YS[] = {2759, 2855, 2877, 3091, 3275, 3482, 3814, 4044, 4384, 4612, 4861, 5110, 5316, 5322, 5420,
+                                     5381, 5284, 5106, 4878, 4675, 4346, 4093, 3819, 3548, 3300, 3110, 2881, 2845, 2764};
+static const uint16_t CHECK_XS[] = {2998, 3150, 3259, 3398, 3548, 3718, 3892, 4075, 4282,
+                                    4458, 4640, 4826, 5054, 5200, 5404, 5606, 5811, 5973};
+static const uint16_t CHECK_YS[] = {4981, 5180, 5331, 5494, 5646, 5809, 5564, 5284, 5024,
+                                    4754, 4525, 4259, 3970, 3731, 3468, 3196, 2943, 2693};
+static const uint16_t CROSS_FIRST_XS[] = {5974, 6130, 6329, 6462, 6606, 6740, 6908, 7049, 7230, 7362, 7514, 7663, 7815, 7942, 8092};
+static const uint16_t CROSS_FIRST_YS[] = {1977, 2178, 2321, 2454, 2660, 2791, 2961, 3094, 3267, 3414, 3589, 3782, 3914, 4051, 4220};
+static const uint16_t CROSS_SECOND_XS[] = {8102, 7941, 7796, 7668, 7526, 7364, 7207, 7073, 6900, 6723, 6611, 6448, 6326, 6180, 6009};
+static const uint16_t CROSS_SECOND_YS[] = {1996, 2139, 2292, 2485, 2662, 2792, 2981, 3095, 3294, 3456, 3606, 3748, 3932, 4079, 4217};
+
+static const uint8_t CIRCLE_POINT_COUNT = sizeof(CIRCLE_XS) / sizeof(CIRCLE_XS[0]);
+static const uint8_t CHECK_POINT_COUNT = sizeof(CHECK_XS) / sizeof(CHECK_XS[0]);
+static const uint8_t CROSS_FRAME_COUNT = sizeof(CROSS_FIRST_XS) / sizeof(CROSS_FIRST_XS[0]);
+
+static TouchGestureRecognizer gestures;
+
+/** Builds an active contact as reported in a touch frame. */
+static TouchPoint makeContact(uint8_t id, uint16_t x, uint16_t y) {
+    TouchPoint point = {};
+    point.id = id;
+    point.x = x;
+    point.y = y;
+    point.active = true;
+
+    return point;
+}
+
+/** Asserts that the captured strokes match the given gesture. */
+static void assertRecognized(uint8_t gestureId) {
+    TouchGestureMatch match;
+    TEST_ASSERT_TRUE(gestures.recognize(match));
+    TEST_ASSERT_EQUAL_UINT8(gestureId, match.gestureId);
+    TEST_ASSERT_TRUE(match.score > 0.5f);
+}
+
+void setUp() {
+    gestures.clearTemplates();
+    gestures.clearStrokes();
+    gestures.addTemplate(GESTURE_CIRCLE, CIRCLE_TEMPLATE_XS, CIRCLE_TEMPLATE_YS, nullptr, 9);
+    gestures.addTemplate(GESTURE_CHECK, CHECK_TEMPLATE_XS, CHECK_TEMPLATE_YS, nullptr, 3);
+    gestures.addTemplate(GESTURE_CROSS, CROSS_TEMPLATE_XS, CROSS_TEMPLATE_YS, CROSS_TEMPLATE_STROKES, 4);
+    gestures.addTemplate(GESTURE_LINE, LINE_TEMPLATE_XS, LINE_TEMPLATE_YS, nullptr, 2);
+}
+
+void tearDown() {
+}
+
+void test_recorded_circle_is_recognized() {
+    for (uint8_t pointIndex = 0; pointIndex < CIRCLE_POINT_COUNT; pointIndex++) {
+        gestures.addPoint(CIRCLE_XS[pointIndex], CIRCLE_YS[pointIndex], 0);
+    }
+
+    assertRecognized(GESTURE_CIRCLE);
+}
+
+void test_recorded_check_is_recognized_from_touch_frames() {
+    for (uint8_t frameIndex = 0; frameIndex < CHECK_POINT_COUNT; frameIndex++) {
+        TouchPoint contact = makeContact(2, CHECK_XS[frameIndex], CHECK_YS[frameIndex]);
+        gestures.addTouches(&contact, 1);
+    }
+
+    assertRecognized(GESTURE_CHECK);
+}
+
+void test_two_finger_cross_is_recognized_as_multistroke() {
+    for (uint8_t frameIndex = 0; frameIndex < CROSS_FRAME_COUNT; frameIndex++) {
+        TouchPoint contacts[2] = {
+            makeContact(0, CROSS_FIRST_XS[frameIndex], CROSS_FIRST_YS[frameIndex]),
+            makeContact(1, CROSS_SECOND_XS[frameIndex], CROSS_SECOND_YS[frameIndex]),
+        };
+        gestures.addTouches(contacts, 2);
+    }
+
+    assertRecognized(GESTURE_CROSS);
+}
+
+void test_long_recorded_stroke_is_compacted_not_cut_off() {
+    // Five laps of the recorded circle overflow the capture buffer
+    for (uint8_t lapIndex = 0; lapIndex < 5; lapIndex++) {
+        for (uint8_t pointIndex = 0; pointIndex < CIRCLE_POINT_COUNT; pointIndex++) {
+            gestures.addPoint(CIRCLE_XS[pointIndex], CIRCLE_YS[pointIndex], 0);
+        }
+    }
+
+    TEST_ASSERT_TRUE(gestures.getPointCount() <= TouchGestureRecognizer::MAX_CAPTURE_POINTS);
+    assertRecognized(GESTURE_CIRCLE);
+}
+
+void test_recognize_fails_without_templates() {
+    gestures.clearTemplates();
+
+    for (uint8_t pointIndex = 0; pointIndex < CHECK_POINT_COUNT; pointIndex++) {
+        gestures.addPoint(CHECK_XS[pointIndex], CHECK_YS[pointIndex], 0);
+    }
+
+    TouchGestureMatch match;
+    TEST_ASSERT_FALSE(gestures.recognize(match));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_recorded_circle_is_recognized);
+    RUN_TEST(test_recorded_check_is_recognized_from_touch_frames);
+    RUN_TEST(test_two_finger_cross_is_recognized_as_multistroke);
+    RUN_TEST(test_long_recorded_stroke_is_compacted_not_cut_off);
+    RUN_TEST(test_recognize_fails_without_templates);
+
+    return UNITY_END();
+}
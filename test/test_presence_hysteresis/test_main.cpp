@@ -0,0 +1,76 @@
+#include "DisplaxTouch.h"
+#include "TouchTestStream.h"
+
+#include <unity.h>
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+/** Runs the initialization handshake against the simulated sensor. */
+static void connect(DisplaxTouch& touch) {
+    touch.begin();
+
+    for (uint8_t iteration = 0; iteration < 8 && touch.getTouchState() != TouchState::SYNCHRONIZED; iteration++) {
+        touch.loop();
+    }
+
+    TEST_ASSERT_TRUE(touch.getTouchState() == TouchState::SYNCHRONIZED);
+}
+
+void test_lifted_contact_is_released_immediately() {
+    TouchTestStream stream;
+    VirtualTouchClock clock;
+    DisplaxTouch touch(stream, clock);
+    touch.setPresenceHysteresis(3);
+    connect(touch);
+
+    const TouchTestContact down[] = {{1, 4000, 3000, 200}};
+    stream.pushTouchReport(down, 1);
+    touch.loop();
+    TEST_ASSERT_EQUAL_UINT8(1, touch.getTouchCount());
+
+    const TouchTestContact lifted[] = {{1, 4000, 3000, 0, false}};
+    clock.advance(10000);
+    stream.pushTouchReport(lifted, 1);
+    touch.loop();
+    TEST_ASSERT_EQUAL_UINT8(0, touch.getTouchCount());
+}
+
+void test_vanished_contact_is_held_as_dropout() {
+    TouchTestStream stream;
+    VirtualTouchClock clock;
+    DisplaxTouch touch(stream, clock);
+    touch.setPresenceHysteresis(3);
+    connect(touch);
+
+    const TouchTestContact both[] = {{1, 4000, 3000, 200}, {2, 9000, 6000, 200}};
+    stream.pushTouchReport(both, 2);
+    touch.loop();
+    TEST_ASSERT_EQUAL_UINT8(2, touch.getTouchCount());
+
+    // Contact 2 drops out without a lift, it is held for two frames and released on the third
+    const TouchTestContact first[] = {{1, 4000, 3000, 200}};
+
+    for (uint8_t frameIndex = 0; frameIndex < 2; frameIndex++) {
+        clock.advance(10000);
+        stream.pushTouchReport(first, 1);
+        touch.loop();
+        TEST_ASSERT_EQUAL_UINT8(2, touch.getTouchCount());
+    }
+
+    clock.advance(10000);
+    stream.pushTouchReport(first, 1);
+    touch.loop();
+    TEST_ASSERT_EQUAL_UINT8(1, touch.getTouchCount());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_lifted_contact_is_released_immediately);
+    RUN_TEST(test_vanished_contact_is_held_as_dropout);
+
+    return UNITY_END();
+}
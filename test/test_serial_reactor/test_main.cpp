@@ -0,0 +1,168 @@
+#include "TouchSerialReactor.h"
+
+#include <unity.h>
+
+#ifdef DISPLAX_TOUCH_EPOLL
+
+#include "TouchSensorSimulator.h"
+
+static constexpr uint8_t SENSOR_COUNT = 8;
+static constexpr uint8_t BURST_REPORTS = 40;
+
+/**
+ * One simulated panel connected to the reactor through a pseudo-terminal.
+ */
+struct Panel {
+    TouchSensorSimulator simulator;
+    int fd = -1;
+    TouchFdStream* stream = nullptr;
+    DisplaxTouch* touch = nullptr;
+    uint32_t frameCount = 0;
+    uint16_t lastX = 0;
+};
+
+static Panel panels[SENSOR_COUNT];
+static TouchSerialReactor reactor;
+
+void setUp() {
+    TEST_ASSERT_TRUE(reactor.begin());
+
+    for (uint8_t panelIndex = 0; panelIndex < SENSOR_COUNT; panelIndex++) {
+        Panel& panel = panels[panelIndex];
+        TEST_ASSERT_TRUE(panel.simulator.open());
+
+        panel.fd = TouchSerialReactor::openSerialPort(panel.simulator.getDevicePath(), 115200);
+        TEST_ASSERT_TRUE(panel.fd >= 0);
+
+        panel.stream = new TouchFdStream(panel.fd);
+        panel.touch = new DisplaxTouch(*panel.stream);
+        panel.touch->addTouchListener([&panel](const TouchPoint* touches, uint8_t count) {
+            // Frames without contacts are releases by the touch timeout once a burst ends
+            if (count > 0) {
+                panel.frameCount++;
+                panel.lastX = touches[0].x;
+            }
+        });
+
+        TEST_ASSERT_TRUE(reactor.addSensor(*panel.stream, *panel.touch));
+        panel.touch->begin();
+    }
+}
+
+void tearDown() {
+    reactor.end();
+
+    for (Panel& panel : panels) {
+        delete panel.touch;
+        delete panel.stream;
+        close(panel.fd);
+        panel.simulator.close();
+        panel.fd = -1;
+        panel.stream = nullptr;
+        panel.touch = nullptr;
+        panel.frameCount = 0;
+        panel.lastX = 0;
+    }
+}
+
+/** Polls the reactor and services the simulators until every driver has synchronized. */
+static void connectAll() {
+    for (uint16_t iteration = 0; iteration < 500; iteration++) {
+        reactor.poll(1);
+
+        bool isSynchronized = true;
+
+        for (Panel& panel : panels) {
+            panel.simulator.service();
+            isSynchronized = isSynchronized && panel.touch->getTouchState() == TouchState::SYNCHRONIZED;
+        }
+
+        if (isSynchronized) {
+            return;
+        }
+    }
+
+    TEST_FAIL_MESSAGE("sensors did not synchronize");
+}
+
+void test_handshake_completes_on_every_sensor() {
+    connectAll();
+
+    TEST_ASSERT_EQUAL_UINT8(SENSOR_COUNT, reactor.getSensorCount());
+
+    for (Panel& panel : panels) {
+        TEST_ASSERT_TRUE(panel.simulator.getSensor().isReporting());
+    }
+}
+
+void test_poll_drains_every_received_report() {
+    connectAll();
+
+    for (uint8_t reportIndex = 0; reportIndex < BURST_REPORTS; reportIndex++) {
+        for (uint8_t panelIndex = 0; panelIndex < SENSOR_COUNT; panelIndex++) {
+            const TouchTestContact contact[] = {{1, static_cast<uint16_t>(1000 + panelIndex * 100 + reportIndex), 3000, 200}};
+            panels[panelIndex].simulator.sendTouchReport(contact, 1);
+        }
+    }
+
+    for (uint16_t iteration = 0; iteration < 200; iteration++) {
+        reactor.poll(1);
+
+        // Each poll consumes every complete report it read, at most a partial report is left for the next read
+        for (Panel& panel : panels) {
+            TEST_ASSERT_TRUE(panel.stream->available() < 72);
+        }
+    }
+
+    for (uint8_t panelIndex = 0; panelIndex < SENSOR_COUNT; panelIndex++) {
+        TEST_ASSERT_EQUAL_UINT32(BURST_REPORTS, panels[panelIndex].frameCount);
+        TEST_ASSERT_EQUAL_UINT16(1000 + panelIndex * 100 + BURST_REPORTS - 1, panels[panelIndex].lastX);
+    }
+}
+
+void test_hangup_only_affects_its_sensor() {
+    connectAll();
+
+    panels[0].simulator.close();
+
+    for (uint8_t iteration = 0; iteration < 20 && panels[0].stream->isOpen(); iteration++) {
+        reactor.poll(1);
+    }
+
+    TEST_ASSERT_FALSE(panels[0].stream->isOpen());
+
+    const TouchTestContact contact[] = {{1, 5000, 3000, 200}};
+    panels[1].simulator.sendTouchReport(contact, 1);
+
+    for (uint8_t iteration = 0; iteration < 20 && panels[1].frameCount == 0; iteration++) {
+        reactor.poll(1);
+    }
+
+    TEST_ASSERT_TRUE(panels[1].stream->isOpen());
+    TEST_ASSERT_EQUAL_UINT16(5000, panels[1].lastX);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_handshake_completes_on_every_sensor);
+    RUN_TEST(test_poll_drains_every_received_report);
+    RUN_TEST(test_hangup_only_affects_its_sensor);
+
+    return UNITY_END();
+}
+
+#else
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main() {
+    UNITY_BEGIN();
+
+    return UNITY_END();
+}
+
+#endif
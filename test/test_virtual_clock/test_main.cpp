@@ -0,0 +1,87 @@
+#include "DisplaxTouch.h"
+#include "TouchTestStream.h"
+
+#include <unity.h>
+
+static const TouchTestContact FINGER[] = {{1, 4000, 3000, 200}};
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+/** Runs the initialization handshake against the simulated sensor. */
+static void connect(DisplaxTouch& touch) {
+    touch.begin();
+
+    for (uint8_t iteration = 0; iteration < 8 && touch.getTouchState() != TouchState::SYNCHRONIZED; iteration++) {
+        touch.loop();
+    }
+
+    TEST_ASSERT_TRUE(touch.getTouchState() == TouchState::SYNCHRONIZED);
+}
+
+void test_initialization_times_out_on_virtual_time() {
+    TouchTestStream stream;
+    VirtualTouchClock clock;
+    DisplaxTouch touch(stream, clock);
+
+    stream.getSensor().setResponding(false);
+    touch.begin();
+
+    clock.advance(999 * 1000UL);
+    touch.loop();
+    TEST_ASSERT_TRUE(touch.getTouchState() == TouchState::INITIALIZING);
+
+    clock.advance(1000);
+    touch.loop();
+    TEST_ASSERT_TRUE(touch.getTouchState() == TouchState::INITIALIZATION_FAILED);
+}
+
+void test_touch_is_released_by_fallback_timeout() {
+    TouchTestStream stream;
+    VirtualTouchClock clock;
+    DisplaxTouch touch(stream, clock);
+    connect(touch);
+
+    stream.pushTouchReport(FINGER, 1);
+    touch.loop();
+    TEST_ASSERT_EQUAL_UINT8(1, touch.getTouchCount());
+
+    // No more reports arrive, only the passage of virtual time releases the touch
+    unsigned long timeoutMs = touch.getEffectiveTouchTimeout();
+    clock.advance((timeoutMs - 1) * 1000UL);
+    touch.loop();
+    TEST_ASSERT_EQUAL_UINT8(1, touch.getTouchCount());
+
+    clock.advance(1000);
+    touch.loop();
+    TEST_ASSERT_EQUAL_UINT8(0, touch.getTouchCount());
+}
+
+void test_replay_faster_than_real_time() {
+    TouchTestStream stream;
+    VirtualTouchClock clock(5000000);
+    DisplaxTouch touch(stream, clock);
+    connect(touch);
+
+    // Ten minutes of reports at 100 Hz replay instantly, timestamps follow the virtual clock
+    for (uint32_t reportIndex = 0; reportIndex < 60000; reportIndex++) {
+        clock.advance(10000);
+        stream.pushTouchReport(FINGER, 1);
+        touch.loop();
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(1, touch.getTouchCount());
+    TEST_ASSERT_UINT32_WITHIN(2000, clock.micros(), touch.getFrameTimestamp());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_initialization_times_out_on_virtual_time);
+    RUN_TEST(test_touch_is_released_by_fallback_timeout);
+    RUN_TEST(test_replay_faster_than_real_time);
+
+    return UNITY_END();
+}